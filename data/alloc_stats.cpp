@@ -0,0 +1,81 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: alloc_stats.cpp
+ * Description: Replacement global operator new/delete that count allocations.
+ */
+
+#include "alloc_stats.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// Only ever incremented; relaxed order is enough for a statistic
+std::atomic<unsigned long long> allocationCount(0);
+
+void* countedAlloc(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+    return std::malloc(size);
+}
+
+void* countedAllocOrThrow(std::size_t size) {
+    for (;;) {
+        void* p = countedAlloc(size);
+        if (p) return p;
+        std::new_handler handler = std::set_new_handler(nullptr);
+        std::set_new_handler(handler);
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* countedAllocOrNull(std::size_t size) {
+    try {
+        return countedAllocOrThrow(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+} // namespace
+
+unsigned long long getAllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size) {
+    return countedAllocOrThrow(size);
+}
+
+void* operator new[](std::size_t size) {
+    return countedAllocOrThrow(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocOrNull(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocOrNull(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
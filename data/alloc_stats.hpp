@@ -0,0 +1,18 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: alloc_stats.hpp
+ * Description: Header file for the allocation counter. alloc_stats.cpp replaces the
+ *              global operator new so that every heap allocation in the program adds
+ *              one to a relaxed atomic counter; the performance HUD shows the count per turn.
+ */
+
+#ifndef ALLOC_STATS_HPP
+#define ALLOC_STATS_HPP
+
+// Heap allocations made through operator new (all threads) since the program started
+unsigned long long getAllocationCount();
+
+#endif
@@ -9,23 +9,41 @@
  */
 
 #include "board_data.hpp"
+#include "trace.hpp"
 #include <algorithm>
 
 // Default constructor - initializes 10x10 board filled with water ('w')
 BoardData::BoardData() : boardSize(10), missCount(0), isHost(true) {
-    boardArray.resize(10, std::vector<char>(10, 'w'));
+    boardArray.resize(10, ArenaVector<char>(10, 'w'));
+    shipIdGrid.assign(10 * 10, -1);
 }
 
 // Parameterized constructor - initializes board with custom size
 BoardData::BoardData(int size) : boardSize(size), missCount(0), isHost(true) {
-    boardArray.resize(size, std::vector<char>(size, 'w'));
+    boardArray.resize(size, ArenaVector<char>(size, 'w'));
+    shipIdGrid.assign(size * size, -1);
+}
+
+// Arena constructor - same as BoardData(size) with every container in arena
+BoardData::BoardData(int size, SessionArena* arena)
+    : boardArray(arena),
+      myShips(arena),
+      shipStatus(std::less<char>(), arena),
+      shipCellMap(std::less<std::pair<int, int>>(), arena),
+      shipIdGrid(arena),
+      boardSize(size),
+      missCount(0),
+      isHost(true) {
+    boardArray.resize(size, ArenaVector<char>(size, 'w', arena));
+    shipIdGrid.assign(size * size, -1);
 }
 
 // Initialize board with specified size and reset all data structures
 void BoardData::initialize(int size) {
     boardSize = size;
     boardArray.clear();
-    boardArray.resize(size, std::vector<char>(size, 'w'));
+    boardArray.resize(size, ArenaVector<char>(size, 'w', getArena()));
+    shipIdGrid.assign(size * size, -1);
     myShips.clear();
     shipStatus.clear();
     shipCellMap.clear();
@@ -39,6 +57,7 @@ void BoardData::clear() {
             boardArray[i][j] = 'w';
         }
     }
+    shipIdGrid.assign(boardSize * boardSize, -1);
     myShips.clear();
     shipStatus.clear();
     shipCellMap.clear();
@@ -48,13 +67,15 @@ void BoardData::clear() {
 // Resize the board to new dimensions
 void BoardData::resize(int newSize) {
     boardArray.clear();
-    boardArray.resize(newSize, std::vector<char>(newSize, 'w'));
+    boardArray.resize(newSize, ArenaVector<char>(newSize, 'w', getArena()));
+    shipIdGrid.assign(newSize * newSize, -1);
     boardSize = newSize;
 }
 
 // Process incoming shot at coordinates (x, y)
 // Returns: 0 = miss, 1 = hit, 2 = ship sunk
 int BoardData::receiveShot(int x, int y) {
+    TRACE_SCOPE("BoardData::receiveShot");
     // Check bounds
     if (x < 0 || x >= boardSize || y < 0 || y >= boardSize) return 0;
     
@@ -70,69 +91,38 @@ int BoardData::receiveShot(int x, int y) {
         return 0; 
     }
 
-    // Ship hit - process hit logic
-    if (cell >= 'A' && cell <= 'Z') {
-        char targetSymbol = cell;
+    // Ship hit - look up the owning ship by id
+    int shipId = getShipIdAt(x, y);
+    if (shipId >= 0 && !myShips[shipId].isSunk) {
+        ActiveShip& ship = myShips[shipId];
+        ship.hitCount++;
         
-        // Find the ship that was hit
-        for (auto& ship : myShips) {
-            if (ship.isSunk) continue;
+        // Check if ship is completely sunk
+        if (ship.hitCount >= ship.length) {
+            ship.isSunk = true;
 
-            if (ship.symbol != targetSymbol) continue;
+            shipStatus[ship.symbol].isSunk = true;
+            shipStatus[ship.symbol].hitCount = ship.hitCount;
             
-            bool isHit = false;
+            // Mark all ship cells as sunk
+            for (int i = 0; i < ship.length; i++) {
+                int r = ship.startRow;
+                int c = ship.startCol;
 
-            // Check if coordinates belong to this ship
-            if (ship.length == 1) {
-                if (x == ship.startCol && y == ship.startRow) {
-                    isHit = true;
-                }
-            }
-            else if (ship.orientation == 1) { // Vertical orientation
-                if (x == ship.startCol && y >= ship.startRow && y < ship.startRow + ship.length) {
-                    isHit = true;
-                }
-            } else { // Horizontal orientation
-                if (y == ship.startRow && x <= ship.startCol && x > ship.startCol - ship.length) {
-                    isHit = true;
+                if (ship.orientation == 1) {
+                    r += i; 
+                } else {
+                    c -= i; 
                 }
-            }
-
-            if (isHit) {
-                ship.hitCount++;
                 
-                // Check if ship is completely sunk
-                if (ship.hitCount >= ship.length) {
-                    ship.isSunk = true;
-
-                    shipStatus[ship.symbol].isSunk = true;
-                    shipStatus[ship.symbol].hitCount = ship.hitCount;
-                    
-                    // Mark all ship cells as sunk
-                    for (int i = 0; i < ship.length; i++) {
-                        int r = ship.startRow;
-                        int c = ship.startCol;
-
-                        if (ship.orientation == 1) {
-                            r += i; 
-                        } else {
-                            c -= i; 
-                        }
-                        
-                        if (r >= 0 && r < boardSize && c >= 0 && c < boardSize) {
-                            boardArray[r][c] = 's'; 
-                        }
-                    }
-                    return 2; // Ship sunk
-                } else {
-                    boardArray[y][x] = 'x';  // Mark as hit
-                    
-                    shipStatus[ship.symbol].hitCount = ship.hitCount;
-                    
-                    return 1; // Hit but not sunk
+                if (r >= 0 && r < boardSize && c >= 0 && c < boardSize) {
+                    boardArray[r][c] = 's'; 
                 }
             }
+            return 2; // Ship sunk
         }
+        
+        shipStatus[ship.symbol].hitCount = ship.hitCount;
     }
 
     boardArray[y][x] = 'x';
@@ -162,8 +152,15 @@ void BoardData::markShipAsHit(char shipSymbol) {
 }
 
 // Get count of ships that are still afloat
+// Counts placed ships; boards without placed ships fall back to the configured shipStatus
 int BoardData::getRemainingShips() {
     int count = 0;
+    if (!myShips.empty()) {
+        for (const auto& ship : myShips) {
+            if (!ship.isSunk) count++;
+        }
+        return count;
+    }
     for (auto& pair : shipStatus) {
         if (!pair.second.isSunk) {
             count++;
@@ -203,38 +200,31 @@ std::vector<std::pair<int, int>> BoardData::getShipCoordinates(char shipSymbol)
     return coords;
 }
 
+// Get id of the ship occupying (x, y), or -1 for water / out of bounds
+int BoardData::getShipIdAt(int x, int y) const {
+    if (x < 0 || x >= boardSize || y < 0 || y >= boardSize) return -1;
+    return shipIdGrid[y * boardSize + x];
+}
+
 // Get all cells occupied by the ship at given coordinates
-std::vector<std::pair<int, int>> BoardData::getShipOccupiedCells(int x, int y) {
+std::vector<std::pair<int, int>> BoardData::getShipOccupiedCells(int x, int y) const {
     std::vector<std::pair<int, int>> cells;
 
-    // Find which ship occupies this cell
-    for (const auto& ship : myShips) {
-        bool belongsToShip = false;
-        if (ship.orientation == 1) { // Vertical
-            if (x == ship.startCol && y >= ship.startRow && y < ship.startRow + ship.length) {
-                belongsToShip = true;
-            }
-        } else { // Horizontal
-            if (y == ship.startRow && x <= ship.startCol && x > ship.startCol - ship.length) {
-                belongsToShip = true;
-            }
-        }
+    int shipId = getShipIdAt(x, y);
+    if (shipId < 0) return cells;
 
-        if (belongsToShip) {
-            // Collect all cells of this ship
-            for (int i = 0; i < ship.length; i++) {
-                int r = ship.startRow;
-                int c = ship.startCol;
+    // Collect all cells of this ship
+    const ActiveShip& ship = myShips[shipId];
+    for (int i = 0; i < ship.length; i++) {
+        int r = ship.startRow;
+        int c = ship.startCol;
 
-                if (ship.orientation == 1) {
-                    r += i; 
-                } else {
-                    c -= i; 
-                }
-                cells.push_back({c, r}); 
-            }
-            return cells; 
+        if (ship.orientation == 1) {
+            r += i; 
+        } else {
+            c -= i; 
         }
+        cells.push_back({c, r}); 
     }
     return cells; 
 }
@@ -277,10 +267,31 @@ void BoardData::addShip(int orientation, int startPos, int length, char symbol)
     if (orientation == 1) { // Vertical
         for (int j = 0; j < length; j++) {
             boardArray[row + j][col] = symbol;
+            shipIdGrid[(row + j) * boardSize + col] = newShip.id;
         }
     } else { // Horizontal
         for (int j = 0; j < length; j++) {
             boardArray[row][col - j] = symbol;
+            shipIdGrid[row * boardSize + col - j] = newShip.id;
+        }
+    }
+}
+
+// Check if a ship of `length` cells can start at startPos (row * boardSize + col)
+short BoardData::checkStartingPeg(int orientation, int startPos, int length) const {
+    int row = startPos / boardSize;
+    int col = startPos % boardSize;
+
+    for (int j = 0; j < length; j++) {
+        if (orientation == 1) {
+            // Vertical placement (going down)
+            if (row + j >= boardSize) return 2;
+            if (boardArray[row + j][col] != 'w') return 3;
+        } else {
+            // Horizontal placement (going left)
+            if (col - j < 0) return 2;
+            if (boardArray[row][col - j] != 'w') return 3;
         }
     }
-}
\ No newline at end of file
+    return 1;
+}
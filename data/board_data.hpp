@@ -11,14 +11,15 @@
 #ifndef BOARD_DATA_HPP
 #define BOARD_DATA_HPP
 
+#include "session_arena.hpp"
 #include <vector>
 #include <map>
 #include <utility>
 
 // Structure representing an active ship on the board
 struct ActiveShip {
-    int id;              // Unique identifier for the ship
-    char symbol;         // Character symbol representing the ship (A-Z)
+    int id;              // Unique identifier for the ship (index in BoardData::myShips)
+    char symbol;         // Display symbol (A-Z); not unique on fleets above 26 ships
     int length;          // Length of the ship in cells
     int hitCount;        // Number of times ship has been hit
     bool isSunk;         // Flag indicating if ship is completely destroyed
@@ -30,10 +31,11 @@ struct ActiveShip {
 // Main class managing the game board state and operations
 class BoardData {
 public:
-    std::vector<std::vector<char>> boardArray;           // 2D array representing board state
-    std::vector<ActiveShip> myShips;                     // List of all ships on this board
-    std::map<char, ActiveShip> shipStatus;               // Map of ship symbols to their status
-    std::map<std::pair<int, int>, char> shipCellMap;     // Map of coordinates to ship symbols
+    ArenaGrid boardArray;                                 // 2D array representing board state
+    ArenaVector<ActiveShip> myShips;                      // List of all ships on this board
+    ArenaMap<char, ActiveShip> shipStatus;                // Map of ship symbols to their status
+    ArenaMap<std::pair<int, int>, char> shipCellMap;      // Map of coordinates to ship symbols
+    ArenaVector<int> shipIdGrid;                          // Ship id per cell (row-major), -1 = none
     int boardSize;                                        // Size of the board (NxN)
     int missCount;                                        // Count of missed shots
     bool isHost;                                          // Flag indicating if this is host's board
@@ -41,6 +43,7 @@ public:
     // Constructors
     BoardData();
     BoardData(int size);
+    BoardData(int size, SessionArena* arena);   // All containers allocate from arena (nullptr = heap)
     
     // Board initialization and management
     void initialize(int size);              // Initialize board with given size
@@ -58,17 +61,25 @@ public:
     int getSunkCount();                      // Get count of completely sunk ships
     int getMissCount() const { return missCount; }  // Get total miss count
     
+    // Id of the ship occupying (x, y), or -1 if none
+    int getShipIdAt(int x, int y) const;
+    
     // Ship coordinate queries
     std::vector<std::pair<int, int>> getShipCoordinates(char shipSymbol);  // Get all coords for ship
-    std::vector<std::pair<int, int>> getShipOccupiedCells(int x, int y);   // Get cells of ship at (x,y)
+    std::vector<std::pair<int, int>> getShipOccupiedCells(int x, int y) const;  // Get cells of ship at (x,y)
     
     // Ship management
     void buildShipCellMap();                // Build coordinate-to-ship mapping
     void addShip(int orientation, int startPos, int length, char symbol);  // Add ship to board
     
+    // Placement check (orientation 1 = vertical down, 2 = horizontal left)
+    // Returns: 1 = valid, 2 = out of bounds, 3 = collides with existing ship
+    short checkStartingPeg(int orientation, int startPos, int length) const;
+    
     // Getters and setters
     void setIsHost(bool host) { isHost = host; }     // Set host flag
     int getBoardSize() const { return boardSize; }   // Get board size
+    SessionArena* getArena() const { return boardArray.get_allocator().getArena(); }
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,144 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: fleet_config.cpp
+ * Description: Implementation of fleet configuration helpers: conversion from the
+ *              standard ShipConfiguration table and parsing of fleet definition files.
+ */
+
+#include "fleet_config.hpp"
+#include "ship_data.hpp"
+#include "volley_summary.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+// Number of ships in the fleet
+int FleetConfig::getTotalShips() const {
+    int total = 0;
+    for (const auto& entry : ships) {
+        total += entry.count;
+    }
+    return total;
+}
+
+// Cells occupied by the whole fleet
+int FleetConfig::getTotalShipCells() const {
+    int total = 0;
+    for (const auto& entry : ships) {
+        total += entry.length * entry.count;
+    }
+    return total;
+}
+
+// Length of the longest ship in the fleet
+int FleetConfig::getLongestShip() const {
+    int longest = 0;
+    for (const auto& entry : ships) {
+        if (entry.count > 0) longest = std::max(longest, entry.length);
+    }
+    return longest;
+}
+
+// Build fleet for a standard board size
+// Sizes outside the table get the 10x10 fleet, like getShipConfig
+FleetConfig getFleetConfig(int boardSize) {
+    ShipConfiguration config = getShipConfig(boardSize);
+
+    FleetConfig fleet;
+    fleet.boardSize = boardSize;
+    fleet.shotsPerTurn = config.shotsPerTurn;
+
+    FleetEntry entries[] = {
+        {4, config.fourDeck},
+        {3, config.threeDeck},
+        {2, config.twoDeck},
+        {1, config.oneDeck}
+    };
+    for (const auto& entry : entries) {
+        if (entry.count > 0) fleet.ships.push_back(entry);
+    }
+    return fleet;
+}
+
+// Parse fleet definition from a stream
+bool parseFleetConfig(std::istream& input, FleetConfig& fleet, std::string& error) {
+    FleetConfig parsed;
+    parsed.boardSize = 0;
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(input, line)) {
+        lineNumber++;
+
+        // Strip comments and skip blank lines
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+
+        std::istringstream fields(line);
+        std::string directive;
+        if (!(fields >> directive)) continue;
+
+        if (directive == "BOARD") {
+            if (!(fields >> parsed.boardSize) || parsed.boardSize < 1 ||
+                parsed.boardSize > FLEET_MAX_BOARD_SIZE) {
+                error = "line " + std::to_string(lineNumber) + ": invalid board size";
+                return false;
+            }
+        } else if (directive == "SHOTS") {
+            if (!(fields >> parsed.shotsPerTurn) || parsed.shotsPerTurn < 1 ||
+                parsed.shotsPerTurn > VOLLEY_MAX_SHOTS) {
+                error = "line " + std::to_string(lineNumber) + ": invalid shot count";
+                return false;
+            }
+        } else if (directive == "SHIP") {
+            FleetEntry entry;
+            if (!(fields >> entry.length >> entry.count) || entry.length < 1 ||
+                entry.length > FLEET_MAX_SHIP_LENGTH || entry.count < 0 ||
+                entry.count > FLEET_MAX_BOARD_SIZE * FLEET_MAX_BOARD_SIZE / entry.length) {
+                error = "line " + std::to_string(lineNumber) + ": invalid ship entry";
+                return false;
+            }
+            if (entry.count > 0) parsed.ships.push_back(entry);
+        } else {
+            error = "line " + std::to_string(lineNumber) + ": unknown directive " + directive;
+            return false;
+        }
+    }
+
+    if (parsed.boardSize == 0) {
+        error = "missing BOARD directive";
+        return false;
+    }
+    if (parsed.ships.empty()) {
+        error = "fleet has no ships";
+        return false;
+    }
+    if (parsed.getLongestShip() > parsed.boardSize) {
+        error = "ship longer than the board";
+        return false;
+    }
+    if ((long long)parsed.getTotalShipCells() > (long long)parsed.boardSize * parsed.boardSize / 2) {
+        error = "fleet covers more than half of the board";
+        return false;
+    }
+
+    // Keep longest ships first so placement starts with the hardest pieces
+    std::stable_sort(parsed.ships.begin(), parsed.ships.end(),
+                     [](const FleetEntry& a, const FleetEntry& b) { return a.length > b.length; });
+
+    fleet = parsed;
+    return true;
+}
+
+// Load fleet definition from a file
+bool loadFleetConfig(const std::string& path, FleetConfig& fleet, std::string& error) {
+    std::ifstream file(path.c_str());
+    if (!file.is_open()) {
+        error = "cannot open " + path;
+        return false;
+    }
+    return parseFleetConfig(file, fleet, error);
+}
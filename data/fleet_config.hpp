@@ -0,0 +1,55 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: fleet_config.hpp
+ * Description: Header file defining loadable fleet configurations. A FleetConfig lists
+ *              ship lengths and counts for any board size, generalizing the fixed
+ *              ShipConfiguration table (1-4 deck ships, boards 10-26).
+ */
+
+#ifndef FLEET_CONFIG_HPP
+#define FLEET_CONFIG_HPP
+
+#include <istream>
+#include <string>
+#include <vector>
+
+// Limits accepted by the fleet loader
+const int FLEET_MAX_BOARD_SIZE = 1000;
+const int FLEET_MAX_SHIP_LENGTH = 1000;
+
+// One ship class of a fleet: `count` ships of `length` cells
+struct FleetEntry {
+    int length;
+    int count;
+};
+
+// Complete fleet definition for one board
+struct FleetConfig {
+    int boardSize;                  // Size of the board (NxN)
+    int shotsPerTurn;               // Shots allowed per turn
+    std::vector<FleetEntry> ships;  // Ship classes, longest first
+
+    FleetConfig() : boardSize(10), shotsPerTurn(5) {}
+
+    int getTotalShips() const;       // Number of ships in the fleet
+    int getTotalShipCells() const;   // Cells occupied by the whole fleet (hits needed to win)
+    int getLongestShip() const;      // Length of the longest ship, 0 if fleet is empty
+};
+
+// Build the fleet for a standard board size from the getShipConfig table
+FleetConfig getFleetConfig(int boardSize);
+
+// Parse a fleet definition. Format, one directive per line ('#' starts a comment):
+//   BOARD <size>            board dimensions (1-1000)
+//   SHOTS <count>           shots per turn, 1-64 (optional, default 5)
+//   SHIP <length> <count>   add `count` ships of `length` cells
+// Returns false and sets error if the definition is malformed or the fleet cannot fit
+bool parseFleetConfig(std::istream& input, FleetConfig& fleet, std::string& error);
+
+// Load a fleet definition from a file (same format as parseFleetConfig)
+bool loadFleetConfig(const std::string& path, FleetConfig& fleet, std::string& error);
+
+#endif
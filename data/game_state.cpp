@@ -14,7 +14,16 @@
 GameState::GameState() 
     : playerHits(0), enemyHits(0), maxHits(0),
       playerShipsRemaining(0), enemyShipsRemaining(0), totalShips(0),
-      playerTurn(true), isHost(true),
+      playerTurn(true), isHost(true), turnNumber(0),
+      boardSize(10), shotsPerTurn(3) {
+}
+
+// Arena constructor - same defaults with both boards in arena
+GameState::GameState(SessionArena* arena)
+    : playerBoard(10, arena), enemyBoard(10, arena),
+      playerHits(0), enemyHits(0), maxHits(0),
+      playerShipsRemaining(0), enemyShipsRemaining(0), totalShips(0),
+      playerTurn(true), isHost(true), turnNumber(0),
       boardSize(10), shotsPerTurn(3) {
 }
 
@@ -31,13 +40,10 @@ void GameState::initialize(int size, int shots, bool host) {
     playerBoard.initialize(size);
     enemyBoard.initialize(size);
     
-    // Initialize enemy known board (fog of war)
-    enemyKnownBoard.clear();
-    enemyKnownBoard.resize(size, std::vector<char>(size, ' '));
-    
     // Reset hit counters
     playerHits = 0;
     enemyHits = 0;
+    turnNumber = 0;
     
     // Host goes first
     playerTurn = host;
@@ -50,17 +56,11 @@ void GameState::reset() {
     playerShipsRemaining = totalShips;
     enemyShipsRemaining = totalShips;
     playerTurn = isHost;
+    turnNumber = 0;
     
     // Clear both boards
     playerBoard.clear();
     enemyBoard.clear();
-    
-    // Reset fog of war
-    for (int i = 0; i < boardSize; i++) {
-        for (int j = 0; j < boardSize; j++) {
-            enemyKnownBoard[i][j] = ' ';
-        }
-    }
 }
 
 // Check if game has ended (either player reached max hits)
@@ -71,4 +71,72 @@ bool GameState::isGameOver() const {
 // Check if player has won the game
 bool GameState::hasPlayerWon() const {
     return playerHits >= maxHits;
-}
\ No newline at end of file
+}
+
+// Record the player's shot result at (x, y)
+void GameState::recordPlayerShot(int x, int y, int result) {
+    if (result == 0) {
+        enemyBoard.boardArray[y][x] = 'o';
+    } else if (result == 1) {
+        playerHits++;
+        enemyBoard.boardArray[y][x] = 'x';
+    } else {
+        playerHits++;
+        enemyShipsRemaining--;
+        markEnemySunk(x, y);
+    }
+}
+
+// Mark one cell of a sunk enemy ship
+void GameState::markEnemySunk(int x, int y) {
+    enemyBoard.boardArray[y][x] = 's';
+}
+
+// Fog of war: the player's record of the enemy board in display terms
+char GameState::getEnemyKnown(int x, int y) const {
+    switch (enemyBoard.boardArray[y][x]) {
+        case 'o': return 'm';
+        case 'x': return 'h';
+        case 's': return 's';
+        default:  return ' ';
+    }
+}
+
+// Convert hit cells 4-connected to (x, y) into sunk cells
+void GameState::floodEnemySunk(int x, int y, std::vector<std::pair<int, int>>& cells) {
+    static const int dx[] = {0, 0, -1, 1};
+    static const int dy[] = {-1, 1, 0, 0};
+    
+    size_t first = cells.size();
+    markEnemySunk(x, y);
+    cells.push_back(std::make_pair(x, y));
+    
+    // Breadth-first over the cells appended so far
+    for (size_t i = first; i < cells.size(); i++) {
+        int cx = cells[i].first;
+        int cy = cells[i].second;
+        for (int k = 0; k < 4; k++) {
+            int nx = cx + dx[k];
+            int ny = cy + dy[k];
+            if (nx >= 0 && nx < boardSize && ny >= 0 && ny < boardSize &&
+                enemyBoard.boardArray[ny][nx] == 'x') {
+                markEnemySunk(nx, ny);
+                cells.push_back(std::make_pair(nx, ny));
+            }
+        }
+    }
+}
+
+// Apply an enemy shot to the player's board
+int GameState::receiveEnemyShot(int x, int y) {
+    int result = playerBoard.receiveShot(x, y);
+    if (result != 0) enemyHits++;
+    if (result == 2) playerShipsRemaining--;
+    return result;
+}
+
+// Hand the turn to the other side
+void GameState::endTurn() {
+    playerTurn = !playerTurn;
+    turnNumber++;
+}
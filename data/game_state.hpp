@@ -13,18 +13,28 @@
 
 #include "board_data.hpp"
 #include "ship_data.hpp"
+#include "session_arena.hpp"
+#include <string>
 #include <vector>
 
 // Structure for game configuration settings
 struct GameSettings {
     int shotsPerTurn;               // Number of shots allowed per turn
+    std::string replayLogPath;      // Append game events here when non-empty (--replay-log)
+    std::string netStatsPath;       // Append network match stats (JSON lines) here when non-empty (--net-stats)
+    std::string shotHistoryPath;    // Opponent shot heat map for AI fleet placement, if non-empty (--shot-history)
+    std::string targetPriorPath;    // Player ship placement prior for AI targeting, if non-empty (--target-prior)
     GameSettings() : shotsPerTurn(3) {}
 };
 
 // Main structure managing complete game state
+// This is the single source of truth for a running game: the game loop, the headless
+// simulator and bot matches (all through TurnEngine) update the same object, one call
+// per shot. The enemy board is the player's only record of the enemy; the fog of war
+// is read from it.
 struct GameState {
     BoardData playerBoard;          // Player's own board with ships
-    BoardData enemyBoard;            // Enemy's board (hidden)
+    BoardData enemyBoard;            // Player's record of the enemy board ('w', 'o', 'x', 's')
     
     int playerHits;                  // Total successful hits by player
     int enemyHits;                   // Total successful hits by enemy
@@ -36,18 +46,40 @@ struct GameState {
     
     bool playerTurn;                 // True if it's player's turn
     bool isHost;                     // True if this player is the host
+    int turnNumber;                  // Volleys completed by both sides
     
     int boardSize;                   // Size of the game board (NxN)
     int shotsPerTurn;                // Shots allowed per turn
     
-    std::vector<std::vector<char>> enemyKnownBoard;  // Fog of war for enemy board
-    
     // Constructor and methods
     GameState();
+    explicit GameState(SessionArena* arena);          // Both boards allocate from arena (nullptr = heap)
     void initialize(int size, int shots, bool host);  // Initialize game with parameters
     void reset();                                      // Reset game to initial state
     bool isGameOver() const;                          // Check if game has ended
     bool hasPlayerWon() const;                        // Check if player won
+    
+    // Fog of war at (x, y) from enemyBoard: ' ' unknown, 'm' miss, 'h' hit, 's' sunk
+    char getEnemyKnown(int x, int y) const;
+    
+    // Record the result (0 = miss, 1 = hit, 2 = sunk) of the player's shot at (x, y)
+    // Updates the enemy board and counters; on sunk only (x, y) is marked,
+    // the rest of the ship is marked with markEnemySunk or floodEnemySunk
+    void recordPlayerShot(int x, int y, int result);
+    
+    // Mark one cell of a sunk enemy ship
+    void markEnemySunk(int x, int y);
+    
+    // Mark every hit cell connected to (x, y) as sunk (used when the ship shape is unknown)
+    // cells: receives the newly marked cells
+    void floodEnemySunk(int x, int y, std::vector<std::pair<int, int>>& cells);
+    
+    // Apply an enemy shot to playerBoard and update counters
+    // Returns: 0 = miss, 1 = hit, 2 = ship sunk
+    int receiveEnemyShot(int x, int y);
+    
+    // Hand the turn to the other side
+    void endTurn();
 };
 
 // Structure for AI coordinate selection
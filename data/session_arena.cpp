@@ -0,0 +1,69 @@
+/*
+ * Battleship-1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: session_arena.cpp
+ * Description: Implementation of the SessionArena bump allocator.
+ */
+
+#include "session_arena.hpp"
+
+// Create an empty arena; the first block is allocated on first use
+SessionArena::SessionArena(size_t size)
+    : current(0), offset(0), blockSize(size), capacity(0) {
+}
+
+// Release every block
+SessionArena::~SessionArena() {
+    for (size_t i = 0; i < blocks.size(); i++) {
+        delete[] blocks[i].data;
+    }
+}
+
+// Allocate aligned memory from the current block, moving on to the next
+// retained block (or a new one) when it does not fit
+// alignment must be a power of two no larger than alignof(std::max_align_t)
+void* SessionArena::allocate(size_t bytes, size_t alignment) {
+    if (bytes == 0) bytes = 1;
+
+    while (current < blocks.size()) {
+        Block& block = blocks[current];
+        size_t aligned = (offset + alignment - 1) & ~(alignment - 1);
+        if (aligned + bytes <= block.size) {
+            offset = aligned + bytes;
+            return block.data + aligned;
+        }
+        current++;
+        offset = 0;
+    }
+
+    // No retained block fits - add one large enough for this request
+    // (new[] returns memory aligned for any fundamental type, so offset 0 is aligned)
+    Block block;
+    block.size = bytes > blockSize ? bytes : blockSize;
+    block.data = new char[block.size];
+    blocks.push_back(block);
+    capacity += block.size;
+
+    current = blocks.size() - 1;
+    offset = bytes;
+    return block.data;
+}
+
+// Rewind to the start of the first block, keeping all blocks for reuse
+void SessionArena::reset() {
+    current = 0;
+    offset = 0;
+}
+
+// Bytes handed out since the last reset (including alignment padding)
+size_t SessionArena::getBytesUsed() const {
+    if (blocks.empty()) return 0;
+
+    size_t used = offset;
+    for (size_t i = 0; i < current && i < blocks.size(); i++) {
+        used += blocks[i].size;
+    }
+    return used;
+}
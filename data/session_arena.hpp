@@ -0,0 +1,114 @@
+/*
+ * Battleship-1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: session_arena.hpp
+ * Description: Header file defining SessionArena, a bump allocator that owns the
+ *              per-game memory of one session, and ArenaAllocator<T>, the standard
+ *              allocator adapter used by BoardData and AILogic containers. reset()
+ *              rewinds the arena in O(1) and keeps its blocks for the next game.
+ */
+
+#ifndef SESSION_ARENA_HPP
+#define SESSION_ARENA_HPP
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <new>
+#include <vector>
+
+// Default size of one arena block (bytes)
+const size_t SESSION_ARENA_BLOCK_SIZE = 64 * 1024;
+
+class SessionArena {
+public:
+    explicit SessionArena(size_t blockSize = SESSION_ARENA_BLOCK_SIZE);
+    ~SessionArena();
+
+    // Allocate `bytes` aligned to `alignment`; memory is reclaimed only by reset()
+    void* allocate(size_t bytes, size_t alignment);
+
+    // Rewind to the first block; every object allocated from the arena must be gone
+    void reset();
+
+    size_t getBytesUsed() const;                      // Bytes handed out since the last reset
+    size_t getCapacity() const { return capacity; }   // Bytes owned across all blocks
+    size_t getBlockCount() const { return blocks.size(); }
+
+private:
+    struct Block {
+        char* data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;   // Blocks in allocation order, kept across resets
+    size_t current;              // Index of the block being filled
+    size_t offset;               // Fill position inside the current block
+    size_t blockSize;            // Size of regular blocks
+    size_t capacity;             // Sum of all block sizes
+
+    SessionArena(const SessionArena&);
+    SessionArena& operator=(const SessionArena&);
+};
+
+// Standard allocator over a SessionArena
+// A null arena falls back to the global heap, so arena-aware containers behave
+// exactly like their std::allocator counterparts outside batch sessions
+template <typename T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+
+    ArenaAllocator() : arena(nullptr) {}
+    ArenaAllocator(SessionArena* a) : arena(a) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.getArena()) {}
+
+    T* allocate(size_t n) {
+        if (arena == nullptr) {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    // Arena memory is released all at once by SessionArena::reset()
+    void deallocate(T* p, size_t) {
+        if (arena == nullptr) {
+            ::operator delete(p);
+        }
+    }
+
+    SessionArena* getArena() const { return arena; }
+
+private:
+    SessionArena* arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.getArena() == b.getArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.getArena() != b.getArena();
+}
+
+// Arena-aware container aliases
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+template <typename T>
+using ArenaDeque = std::deque<T, ArenaAllocator<T>>;
+
+template <typename K, typename V>
+using ArenaMap = std::map<K, V, std::less<K>, ArenaAllocator<std::pair<const K, V>>>;
+
+// 2D grid of cells (rows of chars) with every row in the same arena
+typedef ArenaVector<ArenaVector<char>> ArenaGrid;
+
+#endif
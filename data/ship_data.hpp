@@ -86,6 +86,12 @@ inline ShipConfiguration getShipConfig(int boardSize) {
     return {10, 1, 2, 3, 4, 5};
 }
 
+// Display symbol for a ship. Symbols repeat every 26 ships; ship identity is
+// the ship id, not the letter.
+inline char getShipSymbol(int shipId) {
+    return (char)('A' + (shipId % 26));
+}
+
 // Calculate total number of ships for a given board size
 inline int getTotalShips(int boardSize) {
     auto config = getShipConfig(boardSize);
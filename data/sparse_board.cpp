@@ -0,0 +1,151 @@
+/*
+ * Battleship-1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: sparse_board.cpp
+ * Description: Implementation of the SparseBoardData backend. Cell state is derived
+ *              from the ship and shot maps; untouched cells are implicitly water.
+ */
+
+#include "sparse_board.hpp"
+
+// Default constructor - empty 10x10 board
+SparseBoardData::SparseBoardData() : boardSize(10), missCount(0), sunkCount(0), isHost(true) {
+}
+
+// Parameterized constructor - empty board with custom size
+SparseBoardData::SparseBoardData(int size) : boardSize(size), missCount(0), sunkCount(0), isHost(true) {
+}
+
+// Initialize empty board with specified size
+void SparseBoardData::initialize(int size) {
+    boardSize = size;
+    clear();
+}
+
+// Remove all ships and shots
+void SparseBoardData::clear() {
+    myShips.clear();
+    shipCells.clear();
+    shotCells.clear();
+    missCount = 0;
+    sunkCount = 0;
+}
+
+// Process incoming shot at coordinates (x, y)
+// Returns: 0 = miss, 1 = hit, 2 = ship sunk
+int SparseBoardData::receiveShot(int x, int y) {
+    if (x < 0 || x >= boardSize || y < 0 || y >= boardSize) return 0;
+
+    long long key = cellKey(x, y);
+
+    // Already shot - no action needed
+    if (shotCells.find(key) != shotCells.end()) return 0;
+
+    auto occupant = shipCells.find(key);
+    if (occupant == shipCells.end()) {
+        shotCells[key] = 'o';
+        missCount++;
+        return 0;
+    }
+
+    ActiveShip& ship = myShips[occupant->second];
+    ship.hitCount++;
+
+    if (ship.hitCount < ship.length) {
+        shotCells[key] = 'x';
+        return 1;
+    }
+
+    // Ship sunk - mark every cell of the ship
+    ship.isSunk = true;
+    sunkCount++;
+    for (int i = 0; i < ship.length; i++) {
+        int r = ship.startRow + (ship.orientation == 1 ? i : 0);
+        int c = ship.startCol - (ship.orientation == 1 ? 0 : i);
+        shotCells[cellKey(c, r)] = 's';
+    }
+    return 2;
+}
+
+// Get total count of hit cells on ships that are not yet sunk
+int SparseBoardData::getWoundedCount() const {
+    int count = 0;
+    for (const auto& ship : myShips) {
+        if (!ship.isSunk) count += ship.hitCount;
+    }
+    return count;
+}
+
+// Get cell state in BoardData encoding
+char SparseBoardData::getCell(int x, int y) const {
+    if (x < 0 || x >= boardSize || y < 0 || y >= boardSize) return 'w';
+
+    long long key = cellKey(x, y);
+    auto shot = shotCells.find(key);
+    if (shot != shotCells.end()) return shot->second;
+
+    auto occupant = shipCells.find(key);
+    if (occupant != shipCells.end()) return myShips[occupant->second].symbol;
+    return 'w';
+}
+
+// Get id of the ship occupying (x, y), or -1 if none
+int SparseBoardData::getShipIdAt(int x, int y) const {
+    if (x < 0 || x >= boardSize || y < 0 || y >= boardSize) return -1;
+
+    auto occupant = shipCells.find(cellKey(x, y));
+    return occupant == shipCells.end() ? -1 : occupant->second;
+}
+
+// Get all cells occupied by the ship at given coordinates
+std::vector<std::pair<int, int>> SparseBoardData::getShipOccupiedCells(int x, int y) const {
+    std::vector<std::pair<int, int>> cells;
+
+    int shipId = getShipIdAt(x, y);
+    if (shipId < 0) return cells;
+
+    const ActiveShip& ship = myShips[shipId];
+    for (int i = 0; i < ship.length; i++) {
+        int r = ship.startRow + (ship.orientation == 1 ? i : 0);
+        int c = ship.startCol - (ship.orientation == 1 ? 0 : i);
+        cells.push_back({c, r});
+    }
+    return cells;
+}
+
+// Check if a ship can be placed starting at given position
+// Returns: 1 = valid, 2 = out of bounds, 3 = collides with existing ship
+short SparseBoardData::checkStartingPeg(int orientation, long long startPos, int length) const {
+    int row = (int)(startPos / boardSize);
+    int col = (int)(startPos % boardSize);
+
+    for (int j = 0; j < length; j++) {
+        int r = row + (orientation == 1 ? j : 0);
+        int c = col - (orientation == 1 ? 0 : j);
+        if (r >= boardSize || c < 0) return 2;
+        if (shipCells.find(cellKey(c, r)) != shipCells.end()) return 3;
+    }
+    return 1;
+}
+
+// Add a new ship to the board
+void SparseBoardData::addShip(int orientation, long long startPos, int length, char symbol) {
+    ActiveShip newShip;
+    newShip.id = (int)myShips.size();
+    newShip.symbol = symbol;
+    newShip.length = length;
+    newShip.hitCount = 0;
+    newShip.isSunk = false;
+    newShip.startRow = (int)(startPos / boardSize);
+    newShip.startCol = (int)(startPos % boardSize);
+    newShip.orientation = orientation;
+
+    for (int j = 0; j < length; j++) {
+        int r = newShip.startRow + (orientation == 1 ? j : 0);
+        int c = newShip.startCol - (orientation == 1 ? 0 : j);
+        shipCells[cellKey(c, r)] = newShip.id;
+    }
+    myShips.push_back(newShip);
+}
@@ -0,0 +1,76 @@
+/*
+ * Battleship-1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: sparse_board.hpp
+ * Description: Header file defining SparseBoardData, a placement experiment for boards
+ *              far beyond MAX_BOARD_SIZE. Only occupied and shot cells are stored, in
+ *              hash maps keyed by linear cell index, so placing a fleet (and resolving
+ *              single shots) costs memory and time in proportion to the fleet, not the
+ *              board area. It is not a BoardData backend: no game mode, AILogic,
+ *              TurnEngine or the simulator can play on it, and a large --simulate board
+ *              still allocates dense BoardData grids.
+ */
+
+#ifndef SPARSE_BOARD_HPP
+#define SPARSE_BOARD_HPP
+
+#include "board_data.hpp"
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Largest board dimension the placement experiment accepts (cell indices stay in long long)
+const int SPARSE_MAX_BOARD_SIZE = 1000000;
+
+class SparseBoardData {
+public:
+    std::vector<ActiveShip> myShips;                 // List of all ships on this board
+    std::unordered_map<long long, int> shipCells;    // Cell index -> ship id (occupied cells only)
+    std::unordered_map<long long, char> shotCells;   // Cell index -> 'o' / 'x' / 's' (shot cells only)
+    int boardSize;                                    // Size of the board (NxN)
+    int missCount;                                    // Count of missed shots
+    int sunkCount;                                    // Count of completely sunk ships
+    bool isHost;                                      // Flag indicating if this is host's board
+
+    // Constructors
+    SparseBoardData();
+    SparseBoardData(int size);
+
+    // Board initialization and management
+    void initialize(int size);              // Initialize empty board with given size
+    void clear();                           // Remove all ships and shots
+
+    // Shot processing, returns 0 = miss, 1 = hit, 2 = ship sunk
+    int receiveShot(int x, int y);
+
+    // Statistics and status queries
+    int getRemainingShips() const { return (int)myShips.size() - sunkCount; }
+    int getWoundedCount() const;
+    int getSunkCount() const { return sunkCount; }
+    int getMissCount() const { return missCount; }
+
+    // Cell state in BoardData encoding: 'w' water, 'A'-'Z' ship, 'o' miss, 'x' hit, 's' sunk
+    char getCell(int x, int y) const;
+
+    // Ship queries
+    int getShipIdAt(int x, int y) const;                                  // -1 if no ship at (x, y)
+    std::vector<std::pair<int, int>> getShipOccupiedCells(int x, int y) const;  // Cells of ship at (x, y)
+
+    // Placement check, same contract as GameLogic::checkStartingPeg
+    // orientation: 1 = vertical (down), 2 = horizontal (left)
+    // Returns: 1 = valid, 2 = out of bounds, 3 = collides with existing ship
+    short checkStartingPeg(int orientation, long long startPos, int length) const;
+
+    // Add ship; orientation 1 = vertical (down), otherwise horizontal (left)
+    // startPos: linear position on board (row * boardSize + col)
+    void addShip(int orientation, long long startPos, int length, char symbol);
+
+    int getBoardSize() const { return boardSize; }
+
+private:
+    long long cellKey(int x, int y) const { return (long long)y * boardSize + x; }
+};
+
+#endif
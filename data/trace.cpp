@@ -0,0 +1,139 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: trace.cpp
+ * Description: Implementation of the per-thread span buffers and the Chrome trace writer.
+ */
+
+#include "trace.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+struct TraceEvent {
+    const char* name;
+    long long startNs;
+    long long durationNs;
+};
+
+// One thread's spans. Only the owning thread writes; `count` is published with release
+// order so the writer can read the first `count` events at any time.
+struct TraceBuffer {
+    int id;                             // Chrome "tid"
+    std::atomic<int> count;
+    std::atomic<long long> dropped;
+    std::atomic<bool> inUse;            // Owned by a live thread
+    TraceEvent events[TRACE_BUFFER_EVENTS];
+};
+
+// Buffers are never freed: a finished thread's buffer keeps its spans and is handed to
+// the next new thread, so short-lived worker threads do not pile up buffers
+std::mutex registryMutex;
+std::vector<TraceBuffer*> registry;
+long long traceOrigin = traceNow();
+std::string outputPath;
+
+TraceBuffer* acquireBuffer() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (TraceBuffer* buffer : registry) {
+        bool idle = false;
+        if (buffer->inUse.compare_exchange_strong(idle, true)) return buffer;
+    }
+    TraceBuffer* buffer = new TraceBuffer;
+    buffer->id = (int)registry.size() + 1;
+    buffer->count.store(0);
+    buffer->dropped.store(0);
+    buffer->inUse.store(true);
+    registry.push_back(buffer);
+    return buffer;
+}
+
+// Releases the thread's buffer when the thread exits
+struct ThreadBuffer {
+    TraceBuffer* buffer;
+    ThreadBuffer() : buffer(nullptr) {}
+    ~ThreadBuffer() {
+        if (buffer) buffer->inUse.store(false);
+    }
+};
+
+thread_local ThreadBuffer threadBuffer;
+
+void writeAtExit() {
+    if (!outputPath.empty()) writeChromeTrace(outputPath);
+}
+
+} // namespace
+
+void traceRecord(const char* name, long long startNs, long long endNs) {
+    TraceBuffer* buffer = threadBuffer.buffer;
+    if (!buffer) buffer = threadBuffer.buffer = acquireBuffer();
+
+    int index = buffer->count.load(std::memory_order_relaxed);
+    if (index >= TRACE_BUFFER_EVENTS) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    TraceEvent& event = buffer->events[index];
+    event.name = name;
+    event.startNs = startNs;
+    event.durationNs = endNs - startNs;
+    buffer->count.store(index + 1, std::memory_order_release);
+}
+
+long long getTraceEventCount() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    long long total = 0;
+    for (TraceBuffer* buffer : registry) total += buffer->count.load(std::memory_order_acquire);
+    return total;
+}
+
+long long getTraceDroppedCount() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    long long total = 0;
+    for (TraceBuffer* buffer : registry) total += buffer->dropped.load(std::memory_order_relaxed);
+    return total;
+}
+
+void resetTrace() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (TraceBuffer* buffer : registry) {
+        buffer->count.store(0, std::memory_order_release);
+        buffer->dropped.store(0, std::memory_order_relaxed);
+    }
+}
+
+// Complete ("X") events in microseconds since the program started
+bool writeChromeTrace(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    long long dropped = 0;
+    bool first = true;
+    fputs("{\"traceEvents\":[", file);
+    for (TraceBuffer* buffer : registry) {
+        int count = buffer->count.load(std::memory_order_acquire);
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+        for (int i = 0; i < count; i++) {
+            const TraceEvent& event = buffer->events[i];
+            fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    first ? "" : ",", event.name, buffer->id, (event.startNs - traceOrigin) / 1000.0,
+                    event.durationNs / 1000.0);
+            first = false;
+        }
+    }
+    fprintf(file, "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedSpans\":%lld}}\n", dropped);
+    return fclose(file) == 0;
+}
+
+void setTraceOutput(const std::string& path) {
+    if (outputPath.empty() && !path.empty()) atexit(writeAtExit);
+    outputPath = path;
+}
@@ -0,0 +1,73 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: trace.hpp
+ * Description: Header file for the tracing spans. TRACE_SCOPE("name") records how long
+ *              the rest of the enclosing block takes. It only exists in builds with
+ *              -DSEABATTLE_TRACE (make TRACE=1); otherwise it expands to nothing.
+ *              Each thread appends to its own fixed-size buffer with no locking; the
+ *              buffers are written out as Chrome trace JSON (chrome://tracing, Perfetto).
+ */
+
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <chrono>
+#include <string>
+
+const int TRACE_BUFFER_EVENTS = 1 << 16;    // Spans kept per thread; later ones are counted as dropped
+
+#ifdef SEABATTLE_TRACE
+const bool TRACE_COMPILED = true;
+#else
+const bool TRACE_COMPILED = false;
+#endif
+
+// Nanoseconds on the trace clock
+inline long long traceNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Append a finished span to the calling thread's buffer
+// name: string literal (stored by pointer, written to JSON unescaped)
+void traceRecord(const char* name, long long startNs, long long endNs);
+
+// Spans recorded (kept) and dropped for full buffers, over all threads
+long long getTraceEventCount();
+long long getTraceDroppedCount();
+
+// Forget every recorded span; no other thread may be recording
+void resetTrace();
+
+// Write every thread's spans as Chrome trace JSON; false if the file cannot be written
+bool writeChromeTrace(const std::string& path);
+
+// Write the trace to path when the program exits (--trace)
+void setTraceOutput(const std::string& path);
+
+// Times its own lifetime
+class TraceScope {
+public:
+    explicit TraceScope(const char* spanName) : name(spanName), start(traceNow()) {}
+    ~TraceScope() { traceRecord(name, start, traceNow()); }
+
+private:
+    const char* name;
+    long long start;
+
+    TraceScope(const TraceScope&);
+    TraceScope& operator=(const TraceScope&);
+};
+
+#ifdef SEABATTLE_TRACE
+    #define TRACE_CONCAT_INNER(a, b) a##b
+    #define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+    #define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+#else
+    #define TRACE_SCOPE(name) do { } while (0)
+#endif
+
+#endif
@@ -0,0 +1,102 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: volley_summary.cpp
+ * Description: Implementation of VolleySummary recording and text formatting.
+ */
+
+#include "volley_summary.hpp"
+
+namespace {
+
+// Bounded writer over a fixed char buffer; output is truncated, never overflows
+struct TextWriter {
+    char* buffer;
+    size_t size;
+    size_t length;
+
+    TextWriter(char* b, size_t s) : buffer(b), size(s), length(0) {
+        if (size > 0) buffer[0] = '\0';
+    }
+
+    void put(char c) {
+        if (length + 1 < size) {
+            buffer[length++] = c;
+            buffer[length] = '\0';
+        }
+    }
+
+    void put(const char* text) {
+        while (*text) put(*text++);
+    }
+
+    void put(int value) {
+        char digits[12];
+        int count = 0;
+        unsigned int magnitude = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+        do {
+            digits[count++] = (char)('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude > 0);
+        if (value < 0) put('-');
+        while (count > 0) put(digits[--count]);
+    }
+};
+
+} // namespace
+
+// Start a new volley
+void VolleySummary::clear(bool player) {
+    shotCount = 0;
+    missCount = 0;
+    sunkCount = 0;
+    woundedCount = 0;
+    isPlayer = player;
+}
+
+// Record a shot with its result (ShotOutcome)
+bool VolleySummary::addShot(int x, int y, int result) {
+    if (shotCount >= VOLLEY_MAX_SHOTS) return false;
+
+    VolleyShot& shot = shots[shotCount++];
+    shot.x = (short)x;
+    shot.y = (short)y;
+    shot.result = (unsigned char)result;
+
+    if (result == SHOT_MISS) missCount++;
+    else if (result == SHOT_SUNK) sunkCount++;
+    return true;
+}
+
+// Format coordinates and totals for display, e.g. "A5,B6 - 1 wounded, 1 miss"
+size_t VolleySummary::format(char* buffer, size_t bufferSize) const {
+    TextWriter out(buffer, bufferSize);
+
+    for (int i = 0; i < shotCount; i++) {
+        if (i > 0) out.put(',');
+        out.put((char)('A' + shots[i].x));
+        out.put(shots[i].y + 1);
+    }
+
+    out.put(" - ");
+    bool hasStats = false;
+    if (woundedCount > 0) {
+        out.put(woundedCount);
+        out.put(" wounded");
+        hasStats = true;
+    }
+    if (sunkCount > 0) {
+        if (hasStats) out.put(", ");
+        out.put(sunkCount);
+        out.put(" sunk");
+        hasStats = true;
+    }
+    if (missCount > 0) {
+        if (hasStats) out.put(", ");
+        out.put(missCount);
+        out.put(" miss");
+    }
+    return out.length;
+}
@@ -0,0 +1,61 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: volley_summary.hpp
+ * Description: Header file defining VolleySummary, a fixed-capacity record of one
+ *              volley (shot coordinates, per-shot results and totals). It is the
+ *              structured form used by logs and replays, and formats its display
+ *              text into a caller-provided buffer without heap allocation.
+ */
+
+#ifndef VOLLEY_SUMMARY_HPP
+#define VOLLEY_SUMMARY_HPP
+
+#include <cstddef>
+
+// Largest volley a summary can hold (also the limit on shots per turn)
+const int VOLLEY_MAX_SHOTS = 64;
+
+// Buffer size that always fits VolleySummary::format output
+// (up to 5 characters per coordinate plus separator, and the totals suffix)
+const size_t VOLLEY_TEXT_SIZE = VOLLEY_MAX_SHOTS * 6 + 64;
+
+// Result of a single shot, same values as BoardData::receiveShot
+enum ShotOutcome {
+    SHOT_MISS = 0,
+    SHOT_HIT = 1,
+    SHOT_SUNK = 2
+};
+
+// One shot of a volley
+struct VolleyShot {
+    short x;                 // Column
+    short y;                 // Row
+    unsigned char result;    // ShotOutcome
+};
+
+// Complete volley: shots in firing order plus totals
+struct VolleySummary {
+    VolleyShot shots[VOLLEY_MAX_SHOTS];
+    int shotCount;           // Number of used entries in shots
+    int missCount;           // Shots that missed
+    int sunkCount;           // Ships sunk by this volley
+    int woundedCount;        // Hit cells still afloat after the volley
+    bool isPlayer;           // True for the local player's volley
+
+    VolleySummary() { clear(false); }
+
+    // Start a new volley
+    void clear(bool player);
+
+    // Record a shot; returns false if the volley is already full
+    bool addShot(int x, int y, int result);
+
+    // Write "A5,B6 - 1 wounded, 1 sunk, 1 miss" into buffer (always NUL-terminated)
+    // Returns the number of characters written, excluding the terminator
+    size_t format(char* buffer, size_t bufferSize) const;
+};
+
+#endif
@@ -15,6 +15,8 @@
 #include "../ui/ui_renderer.hpp"
 #include "../ui/ui_config.hpp"
 #include "../logic/game_logic.hpp"
+#include "../logic/shot_history.hpp"
+#include "../logic/target_prior.hpp"
 #include "../data/ship_data.hpp"
 #include <vector>
 #include <cstring>
@@ -48,9 +50,24 @@ void playAIGame(AIDifficulty difficulty) {
     refresh();
     SLEEP_MS(2000);
     
-    // Initialize AI opponent and player board
+    // Initialize AI opponent and game state (player board lives in the state)
     AILogic ai(difficulty, size);
-    BoardData playerBoard(size);
+    
+    // Keep the fleet off the cells this player has tended to shoot first
+    ShotHistory history(size);
+    bool useHistory = !g_gameSettings.shotHistoryPath.empty() &&
+                      history.load(g_gameSettings.shotHistoryPath);
+    if (useHistory) ai.setupBoard(history);
+    
+    // Aim first where players have tended to put their ships on this board size
+    TargetPrior prior;
+    if (!g_gameSettings.targetPriorPath.empty() && prior.load(g_gameSettings.targetPriorPath, size)) {
+        ai.setTargetPrior(&prior);
+    }
+    
+    GameState state;
+    GameLogic::initializeGame(state, size, shots, true);
+    BoardData& playerBoard = state.playerBoard;
     
     // Board setup loop - allows player to generate or manually place ships
     int boardResult = 0;
@@ -59,148 +76,20 @@ void playAIGame(AIDifficulty difficulty) {
         
         // Manual placement mode
         if (boardResult == 0) {
-            BoardLayout layout = calculateBoardLayout(size);
-            std::vector<GamePiece> pieces;
-            GameLogic::initializeGamePieces(playerBoard, pieces);
-            
-            // Manual ship placement variables
-            int shipToPlace = 0;
-            int orientation = 0;  // 0 = horizontal, 1 = vertical
-            int cursorX = layout.board1StartX + 5;
-            int cursorY = layout.startY + 3;
-            int maxCursorX = layout.board1StartX + 5 + (size - 1) * 4;
-            int maxCursorY = layout.startY + 3 + size - 1;
-            
-            // Ship placement loop
-            while (shipToPlace < (int)pieces.size()) {
-                UIRenderer::drawManualBoard(layout, playerBoard);
-                
-                GamePiece ship = pieces[shipToPlace];
-                bool isValid = false;
-                
-                // Highlight current ship placement position
-                UIRenderer::highlightShipPlacement(layout, cursorX, cursorY, 
-                    ship.Get_Piece_Length(), orientation, ship.Get_Piece_Symbol(),
-                    playerBoard, isValid);
-                
-                refresh();
-                
-                // Handle user input for ship placement
-                int ch = getch();
-                int gridX = (cursorX - layout.board1StartX - 5) / 4;
-                int gridY = cursorY - layout.startY - 3;
-                
-                switch (ch) {
-                    case KEY_LEFT:
-                    case 'a':
-                    case 'A':
-                        // Move cursor left with boundary checking
-                        if (orientation == 0) {
-                            if ((cursorX - (4 * (ship.Get_Piece_Length() - 1))) > layout.board1StartX + 5) {
-                                cursorX -= 4;
-                            }
-                        } else {
-                            if (cursorX > layout.board1StartX + 5) {
-                                cursorX -= 4;
-                            }
-                        }
-                        break;
-                    case KEY_RIGHT:
-                    case 'd':
-                    case 'D':
-                        // Move cursor right
-                        if (cursorX < maxCursorX) {
-                            cursorX += 4;
-                        }
-                        break;
-                    case KEY_UP:
-                    case 'w':
-                    case 'W':
-                        // Move cursor up with boundary checking
-                        if (orientation == 1) {
-                            if ((cursorY - (ship.Get_Piece_Length() - 1)) > layout.startY + 3) {
-                                cursorY -= 1;
-                            }
-                        } else {
-                            if (cursorY > layout.startY + 3) {
-                                cursorY -= 1;
-                            }
-                        }
-                        break;
-                    case KEY_DOWN:
-                    case 's':
-                    case 'S':
-                        // Move cursor down
-                        if (cursorY < maxCursorY) {
-                            cursorY += 1;
-                        }
-                        break;
-                    case 'r':
-                    case 'R':
-                        // Rotate ship orientation
-                        if (orientation == 0) {
-                            if ((cursorY - (ship.Get_Piece_Length() - 1)) >= layout.startY + 3) {
-                                orientation = 1;
-                            }
-                        } else {
-                            if ((cursorX - (4 * (ship.Get_Piece_Length() - 1))) >= layout.board1StartX + 5) {
-                                orientation = 0;
-                            }
-                        }
-                        break;
-                    case 'g':
-                    case 'G':
-                        // Return to auto-generation mode
-                        boardResult = -1;
-                        shipToPlace = pieces.size();
-                        break;
-                    case ' ':
-                    case 10:  // Enter key
-                        // Place ship if position is valid
-                        if (isValid) {
-                            if (GameLogic::placeShip(playerBoard, gridX, gridY, orientation, 
-                                ship.Get_Piece_Length(), ship.Get_Piece_Symbol())) {
-                                shipToPlace++;
-                                cursorY = layout.startY + 3;
-                                cursorX = layout.board1StartX + 5;
-                            }
-                        }
-                        break;
-                }
-            }
-            
-            // If user pressed 'G' to regenerate, skip confirmation
-            if (boardResult == -1) {
-                continue;
-            }
-            
-            // Build ship cell map and confirm placement
-            playerBoard.buildShipCellMap();
-            if (UIRenderer::confirmBoardPlacement()) {
-                boardResult = 1;
-            }
+            boardResult = placeShipsManually(playerBoard, size);
         }
     }
 
-    // Initialize game state for AI mode
-    std::vector<std::vector<char>> aiKnownBoard(size, std::vector<char>(size, ' '));
-    BoardData dummyEnemyBoard(size);
-    
+    // Configure game mode parameters (player is host and goes first)
     bool isAI = true;
     void* aiPtr = &ai;
     void* socketPtr = nullptr;
     
     // Start the main game loop
-    GameLoop::runGameLoop(
-        playerBoard,
-        dummyEnemyBoard,
-        aiKnownBoard,
-        size,
-        shots,
-        true,          // Player goes first
-        isAI,
-        aiPtr,
-        socketPtr,
-        true           // Player is host
-    );
+    GameLoop::runGameLoop(state, isAI, aiPtr, socketPtr, nullptr, useHistory ? &history : nullptr);
+    if (useHistory) {
+        // A game left with 'q' never sends game over; its shots are saved, so count it too
+        history.endGame();
+        history.save(g_gameSettings.shotHistoryPath);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,248 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: bot_match.cpp
+ * Description: Implementation of the external bot driver, its command line entry,
+ *              and the built-in bot server.
+ */
+
+#include "bot_match.hpp"
+#include "../logic/game_logic.hpp"
+#include "../logic/turn_engine.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <sstream>
+
+// Play one game through the turn engine, alternating full volleys like simulateGame
+// The state is kept from the bot's side: its fleet is the player board
+bool playBotGame(BotProcess& bot, AIDifficulty ai, const FleetConfig& fleet, bool botFirst,
+                 SessionArena* arena, SimulationResult& result, std::string& error) {
+    result.winner = -1;
+    result.turns = 0;
+    result.shotsFirst = 0;
+    result.shotsSecond = 0;
+
+    AILogic aiPlayer(ai, fleet, arena);
+    GameState state(arena);
+    GameLogic::initializeGame(state, fleet, botFirst);
+    std::string line;
+
+    bot.send(formatBotNewGame(fleet));
+    if (!bot.readLine(line)) {
+        error = "bot did not answer new game";
+        return false;
+    }
+    if (!parseBotFleet(line, fleet, state.playerBoard, error)) return false;
+
+    // No ring attached: the engine resolves shots without emitting events
+    TurnEngine engine(state);
+    BoardData& aiBoard = aiPlayer.getBoard();
+    std::vector<AICoordinates> shots;
+    while (result.winner < 0) {
+        int side = state.playerTurn ? 0 : 1;
+        int fired = 0;
+        engine.beginVolley(fleet.shotsPerTurn);
+        if (side == 0) {
+            bot.send("volley " + std::to_string(fleet.shotsPerTurn));
+            if (!bot.readLine(line) || !parseBotShots(line, fleet.boardSize, fleet.shotsPerTurn, shots)) {
+                error = "bad volley from bot: \"" + line.substr(0, 40) + "\"";
+                return false;
+            }
+
+            // Results go out with the next request, in the same write
+            std::string results = "results";
+            for (const AICoordinates& shot : shots) {
+                int shotResult = engine.firePlayerShot(aiBoard, shot.x, shot.y);
+                results += (shotResult == 0) ? " 0" : (shotResult == 1) ? " 1" : " 2";
+                fired++;
+                if (engine.isOver()) break;
+            }
+            bot.send(results);
+            result.shotsFirst += fired;
+        } else {
+            while (fired < fleet.shotsPerTurn && !engine.isOver()) {
+                AICoordinates shot = aiPlayer.pickAttackCoordinates();
+                if (shot.x == -1 || shot.y == -1) break;
+
+                int shotResult = engine.resolveEnemyShot(shot.x, shot.y);
+                aiPlayer.recordShotResult(shot.x, shot.y, shotResult != 0, shotResult == 2);
+                if (shotResult == 2) aiPlayer.recordSunkShip(state.playerBoard.getShipOccupiedCells(shot.x, shot.y));
+                fired++;
+            }
+            result.shotsSecond += fired;
+        }
+        result.turns++;
+
+        if (engine.isOver()) {
+            result.winner = (state.enemyShipsRemaining <= 0) ? 0 : 1;
+        } else if (fired == 0) {
+            // Nothing left to shoot at - only possible with an unsinkable board
+            result.winner = 1 - side;
+        }
+        engine.endVolley();
+    }
+
+    bot.send(result.winner == 0 ? "end win" : "end loss");
+    return true;
+}
+
+// Play a batch of games reusing one arena, the bot firing first in even games
+SimulationSummary runBotMatch(BotProcess& bot, AIDifficulty ai, const FleetConfig& fleet,
+                              int games, std::string& error) {
+    SimulationSummary summary;
+    SessionArena arena;
+
+    for (int g = 0; g < games; g++) {
+        SimulationResult result;
+        bool played = playBotGame(bot, ai, fleet, g % 2 == 0, &arena, result, error);
+        if (arena.getBytesUsed() > summary.arenaBytesPeak) {
+            summary.arenaBytesPeak = arena.getBytesUsed();
+        }
+        arena.reset();
+        if (!played) break;
+
+        summary.games++;
+        if (result.winner == 0) {
+            summary.winsFirst++;
+        } else {
+            summary.winsSecond++;
+        }
+        summary.totalTurns += result.turns;
+        summary.totalShots += result.shotsFirst + result.shotsSecond;
+        summary.winnerShots += (result.winner == 0) ? result.shotsFirst : result.shotsSecond;
+    }
+    bot.flush();
+
+    summary.arenaCapacity = arena.getCapacity();
+    return summary;
+}
+
+// Command line entry: --bot-match <games> <bot command> [easy|smart] [fleet file]
+int runBotMatchCommand(int argc, char** argv) {
+    int games = (argc > 2) ? atoi(argv[2]) : 0;
+    if (argc < 4 || games < 1) {
+        printf("Usage: %s --bot-match <games> <bot command> [easy|smart] [fleet file]\n", argv[0]);
+        return 1;
+    }
+    AIDifficulty ai = (argc > 4) ? parseDifficulty(argv[4]) : SMART;
+
+    FleetConfig fleet = getFleetConfig(10);
+    std::string error;
+    if (argc > 5 && !loadFleetConfig(argv[5], fleet, error)) {
+        printf("Fleet error: %s\n", error.c_str());
+        return 1;
+    }
+
+    BotProcess bot;
+    if (!bot.start(argv[3], error)) {
+        printf("Bot error: %s\n", error.c_str());
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    SimulationSummary summary = runBotMatch(bot, ai, fleet, games, error);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    unsigned long long roundTrips = bot.getWrites();
+    bot.stop();
+
+    if (summary.games < games) printf("Bot error:      %s (game %d)\n", error.c_str(), summary.games + 1);
+    if (summary.games == 0) return 1;
+    printf("Games:          %d (%dx%d board, %d ships, %d shots/turn)\n",
+           summary.games, fleet.boardSize, fleet.boardSize, fleet.getTotalShips(), fleet.shotsPerTurn);
+    printf("Bot wins:       %d\n", summary.winsFirst);
+    printf("AI wins:        %d\n", summary.winsSecond);
+    printf("Avg shots:      %.2f\n", (double)summary.totalShots / summary.games);
+    printf("Shots to win:   %.2f\n", (double)summary.winnerShots / summary.games);
+    printf("Round trips:    %llu\n", roundTrips);
+    printf("Time:           %.3f s (%.1f games/s, %.0f moves/s)\n", seconds,
+           seconds > 0 ? summary.games / seconds : 0.0, seconds > 0 ? summary.totalShots / seconds : 0.0);
+    return summary.games == games ? 0 : 1;
+}
+
+// Fleet of a "new" line; lengths of a class must be adjacent, as formatBotNewGame writes them
+static bool parseNewGame(const char* line, FleetConfig& fleet) {
+    std::istringstream in(line + 3);
+    fleet.ships.clear();
+    if (!(in >> fleet.boardSize >> fleet.shotsPerTurn)) return false;
+    if (fleet.boardSize < 1 || fleet.boardSize > FLEET_MAX_BOARD_SIZE || fleet.shotsPerTurn < 1) return false;
+
+    int length;
+    while (in >> length) {
+        if (length < 1 || length > fleet.boardSize) return false;
+        if (!fleet.ships.empty() && fleet.ships.back().length == length) {
+            fleet.ships.back().count++;
+        } else {
+            FleetEntry entry = { length, 1 };
+            fleet.ships.push_back(entry);
+        }
+    }
+    return !fleet.ships.empty() && in.eof();
+}
+
+// Serve one request per line; only "new" and "volley" are answered
+int runBotServer(FILE* in, FILE* out, AIDifficulty diff) {
+    std::unique_ptr<AILogic> ai;
+    std::vector<AICoordinates> volley;
+    std::string reply;
+    std::vector<char> line(BOT_READ_BUFFER);
+
+    while (fgets(line.data(), (int)line.size(), in)) {
+        // Lines longer than the buffer (huge fleets): keep reading
+        while (strchr(line.data(), '\n') == nullptr && !feof(in)) {
+            size_t used = strlen(line.data());
+            line.resize(line.size() * 2);
+            if (!fgets(line.data() + used, (int)(line.size() - used), in)) break;
+        }
+        const char* request = line.data();
+
+        if (strncmp(request, "new ", 4) == 0) {
+            FleetConfig fleet;
+            if (!parseNewGame(request, fleet)) return 1;
+            ai.reset(new AILogic(diff, fleet));
+            reply = formatBotFleet(ai->getBoard());
+        } else if (strncmp(request, "volley ", 7) == 0 && ai) {
+            int count = atoi(request + 7);
+            volley.clear();
+            reply = "shots";
+            for (int i = 0; i < count; i++) {
+                AICoordinates shot = ai->pickAttackCoordinates();
+                if (shot.x == -1 || shot.y == -1) break;
+                volley.push_back(shot);
+                reply += " " + std::to_string(shot.x) + " " + std::to_string(shot.y);
+            }
+        } else if (strncmp(request, "results", 7) == 0 && ai) {
+            // Results arrive for the whole volley at once
+            char* cursor = line.data() + 7;
+            for (const AICoordinates& shot : volley) {
+                char* end;
+                long result = strtol(cursor, &end, 10);
+                if (end == cursor) break;
+                cursor = end;
+                ai->recordShotResult(shot.x, shot.y, result != 0, result == 2);
+            }
+            continue;
+        } else if (strncmp(request, "quit", 4) == 0) {
+            return 0;
+        } else {
+            continue;
+        }
+
+        fputs(reply.c_str(), out);
+        fputc('\n', out);
+        fflush(out);
+    }
+    return 0;
+}
+
+// Command line entry: --bot [easy|smart]
+int runBotCommand(int argc, char** argv) {
+    AIDifficulty diff = (argc > 2) ? parseDifficulty(argv[2]) : SMART;
+    
+    static char outBuffer[BOT_READ_BUFFER];
+    setvbuf(stdout, outBuffer, _IOFBF, sizeof(outBuffer));
+    return runBotServer(stdin, stdout, diff);
+}
@@ -0,0 +1,41 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: bot_match.hpp
+ * Description: Header file for matches against external bots. The driver plays the
+ *              built-in AILogic against a BotProcess over the bot protocol (see
+ *              bot_process.hpp), headless like the simulator; the bot server is
+ *              the other end, letting this program itself act as a bot.
+ */
+
+#ifndef BOT_MATCH_HPP
+#define BOT_MATCH_HPP
+
+#include "simulation.hpp"
+#include "../logic/bot_process.hpp"
+#include <cstdio>
+
+// Play one game of the bot against an AI of difficulty ai
+// result.winner: 0 = bot, 1 = AI; shotsFirst / shotsSecond are the bot's / AI's shots
+// Returns false, with the reason in error, if the bot broke the protocol
+bool playBotGame(BotProcess& bot, AIDifficulty ai, const FleetConfig& fleet, bool botFirst,
+                 SessionArena* arena, SimulationResult& result, std::string& error);
+
+// Play `games` games, alternating who fires first; winsFirst counts the bot's wins
+// Stops early on a protocol error (summary.games tells how many were finished)
+SimulationSummary runBotMatch(BotProcess& bot, AIDifficulty ai, const FleetConfig& fleet,
+                              int games, std::string& error);
+
+// Command line entry: --bot-match <games> <bot command> [easy|smart] [fleet file]
+int runBotMatchCommand(int argc, char** argv);
+
+// Answer the bot protocol on in/out with an AILogic of difficulty diff until "quit" or EOF
+// Returns the process exit code
+int runBotServer(FILE* in, FILE* out, AIDifficulty diff);
+
+// Command line entry: --bot [easy|smart]
+int runBotCommand(int argc, char** argv);
+
+#endif
@@ -62,4 +62,96 @@ int setupPlayerBoard(BoardData& board, int size) {
         }
     }
     return 1;
-}
\ No newline at end of file
+}
+
+// Manual ship placement shared by the AI and multiplayer setup screens
+// The cursor is tracked in grid cells and converted through the layout,
+// so standard and compact boards behave the same
+int placeShipsManually(BoardData& board, int size) {
+    BoardLayout layout = calculateBoardLayout(size);
+    std::vector<GamePiece> pieces;
+    GameLogic::initializeGamePieces(board, pieces);
+    
+    // Manual ship placement variables
+    int shipToPlace = 0;
+    int orientation = 0;  // 0 = horizontal, 1 = vertical
+    int gridX = 0, gridY = 0;
+    
+    // Ship placement loop
+    while (shipToPlace < (int)pieces.size()) {
+        UIRenderer::drawManualBoard(layout, board);
+        
+        GamePiece ship = pieces[shipToPlace];
+        int length = ship.Get_Piece_Length();
+        bool isValid = false;
+        
+        // Highlight current ship placement position
+        UIRenderer::highlightShipPlacement(layout, layout.playerCellX(gridX), layout.cellY(gridY),
+            length, orientation, ship.Get_Piece_Symbol(), board, isValid);
+        
+        refresh();
+        
+        // Handle user input for ship placement
+        switch (getch()) {
+            case KEY_LEFT:
+            case 'a':
+            case 'A':
+                // Move cursor left, keeping horizontal ships on the board
+                if (orientation == 0 ? gridX - (length - 1) > 0 : gridX > 0) {
+                    gridX--;
+                }
+                break;
+            case KEY_RIGHT:
+            case 'd':
+            case 'D':
+                // Move cursor right
+                if (gridX < size - 1) {
+                    gridX++;
+                }
+                break;
+            case KEY_UP:
+            case 'w':
+            case 'W':
+                // Move cursor up, keeping vertical ships on the board
+                if (orientation == 1 ? gridY - (length - 1) > 0 : gridY > 0) {
+                    gridY--;
+                }
+                break;
+            case KEY_DOWN:
+            case 's':
+            case 'S':
+                // Move cursor down
+                if (gridY < size - 1) {
+                    gridY++;
+                }
+                break;
+            case 'r':
+            case 'R':
+                // Rotate ship orientation if it still fits
+                if (orientation == 0) {
+                    if (gridY - (length - 1) >= 0) orientation = 1;
+                } else {
+                    if (gridX - (length - 1) >= 0) orientation = 0;
+                }
+                break;
+            case 'g':
+            case 'G':
+                // Return to auto-generation mode
+                return -1;
+            case ' ':
+            case 10:  // Enter key
+                // Place ship if position is valid
+                if (isValid && GameLogic::placeShip(board, gridX, gridY, orientation,
+                                                    length, ship.Get_Piece_Symbol())) {
+                    shipToPlace++;
+                    gridX = 0;
+                    gridY = 0;
+                }
+                break;
+        }
+    }
+    
+    // Build ship cell map and confirm placement
+    board.buildShipCellMap();
+    return UIRenderer::confirmBoardPlacement() ? 1 : 0;
+}
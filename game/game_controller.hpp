@@ -4,8 +4,9 @@
  * Author: Poshtak
  * 
  * File: game_controller.hpp
- * Description: Header file for game controller functions. Declares the main function
- *              for setting up player board with automatic generation options.
+ * Description: Header file for game controller functions. Declares the functions
+ *              for setting up player board with automatic generation options and
+ *              manual ship placement.
  */
 
 #ifndef GAME_CONTROLLER_HPP
@@ -20,4 +21,10 @@
 // Returns: 1 = accepted, 0 = manual mode, -1 = regenerate
 int setupPlayerBoard(BoardData& board, int size);
 
+// Let the player place every ship by hand, then confirm the board
+// board: cleared board to place ships on
+// size: board dimensions (NxN)
+// Returns: 1 = placed and accepted, 0 = declined, -1 = back to auto-generation
+int placeShipsManually(BoardData& board, int size);
+
 #endif
\ No newline at end of file
@@ -12,11 +12,19 @@
 #include "game_loop.hpp"
 #include "../ui/ui_renderer.hpp"
 #include "../ui/ui_animation.hpp"
+#include "../ui/board_screen.hpp"
+#include "../ui/board_event_renderer.hpp"
+#include "../ui/perf_hud.hpp"
 #include "../logic/ai_logic.hpp"
-#include "../logic/network_logic.hpp"
+#include "../logic/net_session.hpp"
 #include "../logic/game_logic.hpp"
+#include "../logic/turn_engine.hpp"
+#include "../logic/replay_log.hpp"
+#include "../logic/spectator_hub.hpp"
+#include "../logic/shot_history.hpp"
+#include "../data/trace.hpp"
+#include <algorithm>
 #include <string>
-#include <deque>
 #include <cstring>
 
 #ifdef _WIN32
@@ -27,43 +35,110 @@
     #define SLEEP_MS(x) usleep((x) * 1000)
 #endif
 
+extern GameSettings g_gameSettings;
+
+namespace {
+
+// Push the frame to the terminal; on slow remote terminals this is where a turn's time goes
+// hud: performance overlay that measures the frame, or nullptr
+void refreshScreen(PerfHud* hud = nullptr) {
+    TRACE_SCOPE("refresh");
+    if (hud) hud->beginFrame();
+    refresh();
+    if (hud) hud->endFrame();
+}
+
+// Answers each of the opponent's shots over the network as it is resolved
+class NetworkEventSender : public GameEventConsumer {
+public:
+    explicit NetworkEventSender(NetSession* netSession) : session(netSession) {}
+
+    void onEvent(const GameEvent& event) {
+        if (event.side != ENEMY_SIDE) return;
+
+        if (event.type == EVENT_MISS) {
+            session->answerShot(0);
+        } else if (event.type == EVENT_HIT) {
+            session->answerShot(1);
+        } else if (event.type == EVENT_SUNK) {
+            session->answerShot(2);
+        }
+    }
+
+private:
+    NetSession* session;
+};
+
+// Turn prompt on row 1, centred on the terminal; it stays right of the "instructions"
+// heading and is cut at the right edge, so it shows on compact layouts too
+void showStatus(const char* text, int colorPair) {
+    const int STATUS_ROW = 1;
+    const int STATUS_MIN_X = 14;
+    
+    int maxX = getmaxx(stdscr);
+    int length = (int)strlen(text);
+    int x = std::max(STATUS_MIN_X, (maxX - length) / 2);
+    
+    // The previous prompt may have started further left
+    move(STATUS_ROW, STATUS_MIN_X);
+    clrtoeol();
+    if (x < maxX) {
+        UIRenderer::showMessage(STATUS_ROW, x, std::string(text, std::min(length, maxX - x)), colorPair);
+    }
+}
+
+// Sleep for the UI; in network games keep answering heartbeats meanwhile
+void pauseFor(NetSession* session, int milliseconds) {
+    if (session) {
+        session->idle(milliseconds);
+    } else {
+        SLEEP_MS(milliseconds);
+    }
+}
+
+// Wait for a dropped opponent to reconnect; the volley continues where it stopped
+bool reconnect(NetSession& session, int turnNumber) {
+    showStatus("Connection lost - reconnecting...", 4);
+    refreshScreen();
+    return session.resume(turnNumber);
+}
+
+// The opponent did not come back: end the game
+void showConnectionLost(NetSession& session) {
+    clear();
+    mvprintw(5, 2, "Error: Connection lost!");
+    mvprintw(6, 2, "Press any key to exit...");
+    refreshScreen();
+    getch();
+    session.close();
+    clear();
+}
+
+} // namespace
+
 // Main game loop that alternates between player and opponent turns
 // Handles shot selection, firing, board updates, and victory conditions
-// playerBoard: player's board data
-// enemyBoard: enemy's board data
-// enemyKnownBoard: player's knowledge of enemy board (fog of war)
-// size: board dimensions
-// shots: number of shots per turn
-// playerTurn: whether player goes first
+// state: game state (boards, fog of war, counters, turn) - the only copy of it
 // isAI: true for AI opponent, false for network multiplayer
 // aiPtr: pointer to AI logic (if AI mode)
-// socketPtr: pointer to network socket (if multiplayer mode)
-// isHost: whether player is host in multiplayer
+// socketPtr: pointer to the NetSession (if multiplayer mode)
+// spectators: observers to stream the match to (host only), or nullptr
+// shotHistory: heat map of the player's shots (AI games with --shot-history), or nullptr
 void GameLoop::runGameLoop(
-    BoardData& playerBoard,
-    BoardData& enemyBoard,
-    std::vector<std::vector<char>>& enemyKnownBoard,
-    int size,
-    int shots,
-    bool playerTurn,
+    GameState& state,
     bool& isAI,
     void* aiPtr,
     void* socketPtr,
-    bool isHost
+    SpectatorHub* spectators,
+    ShotHistory* shotHistory
 ) {
-    // Calculate board layout for UI rendering
-    BoardLayout layout = calculateBoardLayout(size);
-    int totalShips = getTotalShips(size);
-    
-    // Initialize game statistics
-    int playerHits = 0;
-    int enemyHits = 0;
-    int playerShipsRemaining = totalShips;
-    int enemyShipsRemaining = totalShips;
+    int size = state.boardSize;
+    int shots = state.shotsPerTurn;
+    BoardData& playerBoard = state.playerBoard;
     
     // Cast pointers based on game mode (AI or multiplayer)
     AILogic* ai = isAI ? static_cast<AILogic*>(aiPtr) : nullptr;
-    SOCKET_TYPE* clientSocket = !isAI ? static_cast<SOCKET_TYPE*>(socketPtr) : nullptr;
+    NetSession* session = !isAI ? static_cast<NetSession*>(socketPtr) : nullptr;
     
     clear();
     
@@ -84,24 +159,27 @@ void GameLoop::runGameLoop(
         oppTitle = (size >= 20) ? "Opp" : (size >= 15) ? "Opponent" : "Opp. Board";
     }
     
-    // Draw initial game UI
-    UIRenderer::drawGameBoards(layout, size, yourTitle, oppTitle);
-    UIRenderer::drawInstructions(layout);
-    UIRenderer::drawBoardState(layout, playerBoard, true);
+    // Draw initial game UI; the screen keeps a copy of both boards for redraws after a resize
+    BoardScreen screen(size, yourTitle, oppTitle);
+    screen.loadBoard(playerBoard, true);
+    screen.loadBoard(state.enemyBoard, false);
+    screen.draw();
+    UIRenderer::drawInstructions(screen.getLayout(), isAI);
+    bool screenFits = true;
     
     // Initialize cursor for shot selection on enemy board
-    int cursorX = layout.board2StartX + 9;
-    int cursorY = layout.startY + 3;
-    int maxCursorX = cursorX + (size - 1) * 4;
-    int maxCursorY = cursorY + size - 1;
     int gridX = 0, gridY = 0;
+    int cursorX = screen.cellScreenX(gridX, false);
+    int cursorY = screen.cellScreenY(gridY);
     
-    // Initialize shot selection array
+    // Initialize shot selection array (a volley record holds at most VOLLEY_MAX_SHOTS)
+    if (shots > VOLLEY_MAX_SHOTS) shots = VOLLEY_MAX_SHOTS;
     std::vector<PendingShot> playerShots(shots);
     for (int i = 0; i < shots; i++) playerShots[i].used = false;
     
     int shotsSelected = 0;
     bool selectingMode = true;
+    
 
     // Get terminal dimensions for animation positioning
     int maxY, maxX; 
@@ -109,33 +187,102 @@ void GameLoop::runGameLoop(
     int animStartY = maxY - 6;
     int animFrame = 0;
     
-    // Calculate positions for volley result display
-    int playerStatsY = layout.startY + 3 + size + 2;
-    int enemyStatsY = layout.startY + 3 + size + 5;
+    // Turn engine resolves shots; renderer, network sender and replay log consume its events
+    GameEventRing events;
+    TurnEngine engine(state);
+    engine.attach(&events);
+    
+    BoardEventRenderer renderer(screen);
+    NetworkEventSender networkSender(session);
+    ReplayLogger replayLog;
+    if (!g_gameSettings.replayLogPath.empty()) {
+        replayLog.open(g_gameSettings.replayLogPath, size, shots);
+    }
+    GameEventConsumer* consumers[] = {
+        session ? &networkSender : nullptr,
+        &renderer,
+        replayLog.isOpen() ? &replayLog : nullptr,
+        spectators,
+        shotHistory
+    };
+    const int consumerCount = sizeof(consumers) / sizeof(consumers[0]);
+    
+    // AI volley planned in the background while the player is selecting
+    std::future<AIVolleyPlan> aiPlan;
+    
+    // AI heat map over the player's board ('h'); redrawn once per turn while shown
+    bool showHeat = false;
+    int heatTurn = -1;
+    
+    // Performance overlay ('p') below the game statistics
+    PerfHud hud;
+    const int hudY = 4;
+    
+    // Link telemetry for the status line and the overlay, refreshed once per turn
+    char netStatus[64] = "";
+    NetStats netStats = NetStats();
+    int netStatsTurn = -1;
     
     // Main game loop - continues until one player loses all ships
-    while (playerShipsRemaining > 0 && enemyShipsRemaining > 0) {
-        // Update and display game statistics
-        UIRenderer::drawGameStats(0, maxX - 35, playerShipsRemaining, enemyShipsRemaining);
+    while (state.playerShipsRemaining > 0 && state.enemyShipsRemaining > 0) {
+        // Let new spectators join and catch up
+        if (spectators) spectators->poll();
+        hud.checkTurn(state.turnNumber);
+        
+        // Keep the link alive while this side is busy
+        if (session) {
+            while (!session->heartbeat()) {
+                if (!reconnect(*session, state.turnNumber)) {
+                    showConnectionLost(*session);
+                    return;
+                }
+                netStatsTurn = -1;
+            }
+            if (netStatsTurn != state.turnNumber) {
+                netStats = session->getStats();
+                formatNetStatus(netStats, netStatus, sizeof(netStatus));
+                netStatsTurn = state.turnNumber;
+            }
+        }
         
-        // Draw decorative ship animation at bottom if space available
-        if (animStartY > layout.startY + 3 + size + 5) {
-            UIAnimation::drawBottomShipAnimation(animFrame, animStartY, maxX);
+        if (screenFits) {
+            // Update and display game statistics
+            UIRenderer::drawGameStats(0, maxX - 35, state.playerShipsRemaining, state.enemyShipsRemaining,
+                                      session ? netStatus : nullptr);
+            if (hud.isShown()) {
+                hud.draw(hudY, maxX - 35, session ? &netStats : nullptr);
+            }
+            
+            // Draw decorative ship animation at bottom if space available
+            if (animStartY > screen.cellScreenY(size) + 5) {
+                UIAnimation::drawBottomShipAnimation(animFrame, animStartY, maxX);
+            }
         }
         
-        if (playerTurn) {
+        if (state.playerTurn) {
             if (selectingMode) {
                 // PLAYER TURN - SHOT SELECTION PHASE
+                // The player's board cannot change until the AI fires, so its volley can be worked out now
+                if (ai && !aiPlan.valid()) {
+                    aiPlan = ai->prefetchVolley(playerBoard, shots);
+                }
+                
                 // Display instruction message
-                char msg[70];
-                sprintf(msg, "Select %d (or less) targets (%d/%d) - F to fire", 
-                        shots, shotsSelected, shots);
-                UIRenderer::showMessage(1, 82, msg, 6);
-                UIRenderer::drawCursor(cursorY, cursorX);
-                refresh();
+                if (screenFits) {
+                    if (showHeat && heatTurn != state.turnNumber) {
+                        screen.drawHeat(ai->getDensityGrid(), true);
+                        heatTurn = state.turnNumber;
+                    }
+                    char msg[70];
+                    sprintf(msg, "Select %d (or less) targets (%d/%d) - F to fire", 
+                            shots, shotsSelected, shots);
+                    showStatus(msg, 6);
+                    UIRenderer::drawCursor(cursorY, cursorX);
+                }
+                refreshScreen(&hud);
                 
                 // Animate and handle input
-                SLEEP_MS(50);
+                pauseFor(session, 50);
                 animFrame++;
                 if (animFrame >= 80) animFrame = 0;
                 
@@ -147,44 +294,64 @@ void GameLoop::runGameLoop(
                 if (key == ERR) continue;
                 flushinp();
                 
+                if (key == KEY_RESIZE) {
+                    // Move the boards to the new layout and redraw them from the screen cache
+                    screen.relayout();
+                    getmaxyx(stdscr, maxY, maxX);
+                    animStartY = maxY - 6;
+                    screenFits = screen.fits();
+                    if (!screenFits) {
+                        UIRenderer::drawResizeNotice(size);
+                        continue;
+                    }
+                    
+                    clear();
+                    screen.draw();
+                    UIRenderer::drawInstructions(screen.getLayout(), isAI);
+                    renderer.redrawVolleys();
+                    heatTurn = -1;
+                    cursorX = screen.cellScreenX(gridX, false);
+                    cursorY = screen.cellScreenY(gridY);
+                    for (int i = 0; i < shotsSelected; i++) {
+                        UIRenderer::drawShotIndicator(screen.cellScreenY(playerShots[i].y),
+                                                      screen.cellScreenX(playerShots[i].x, false), true);
+                    }
+                    continue;
+                }
+                
+                // Only quitting is possible until the terminal is large enough again
+                if (!screenFits && key != 'q' && key != 'Q') continue;
+                
                 // Handle cursor movement and shot selection
                 switch (key) {
                     case KEY_LEFT:
                     case 'a':
                     case 'A':
                         // Move cursor left
-                        if (cursorX > layout.board2StartX + 9 && gridX > 0) {
-                            cursorX -= 4; gridX--;
-                        }
+                        if (gridX > 0) gridX--;
                         break;
                     case KEY_RIGHT:
                     case 'd':
                     case 'D':
                         // Move cursor right
-                        if (cursorX < maxCursorX && gridX < size - 1) {
-                            cursorX += 4; gridX++;
-                        }
+                        if (gridX < size - 1) gridX++;
                         break;
                     case KEY_UP:
                     case 'w':
                     case 'W':
                         // Move cursor up
-                        if (cursorY > layout.startY + 3 && gridY > 0) {
-                            cursorY -= 1; gridY--;
-                        }
+                        if (gridY > 0) gridY--;
                         break;
                     case KEY_DOWN:
                     case 's':
                     case 'S':
                         // Move cursor down
-                        if (cursorY < maxCursorY && gridY < size - 1) {
-                            cursorY += 1; gridY++;
-                        }
+                        if (gridY < size - 1) gridY++;
                         break;
                     case ' ':
                     case 10:
                         // Select/deselect shot at cursor position
-                        if (enemyKnownBoard[gridY][gridX] == ' ' && shotsSelected < shots) {
+                        if (state.getEnemyKnown(gridX, gridY) == ' ' && shotsSelected < shots) {
                             // Check if position already selected
                             bool alreadySelected = false;
                             for (int i = 0; i < shotsSelected; i++) {
@@ -210,245 +377,97 @@ void GameLoop::runGameLoop(
                             selectingMode = false;
                         }
                         break;
+                    case 'h':
+                    case 'H':
+                        // Toggle where the AI expects the player's ships to be
+                        if (ai) {
+                            showHeat = !showHeat;
+                            heatTurn = -1;
+                            if (!showHeat) {
+                                screen.draw();
+                                for (int i = 0; i < shotsSelected; i++) {
+                                    UIRenderer::drawShotIndicator(screen.cellScreenY(playerShots[i].y),
+                                                                  screen.cellScreenX(playerShots[i].x, false), true);
+                                }
+                            }
+                        }
+                        break;
+                    case 'p':
+                    case 'P':
+                        // Toggle the performance overlay
+                        hud.toggle();
+                        if (!hud.isShown()) hud.blank(hudY, maxX - 35);
+                        break;
                     case 'q':
                     case 'Q':
                         // Quit game
-                        if (!isAI && clientSocket) {
-                            closesocket(*clientSocket);
+                        if (!isAI && session) {
+                            session->close();
                         }
                         return;
                 }
+                cursorX = screen.cellScreenX(gridX, false);
+                cursorY = screen.cellScreenY(gridY);
             } else {
                 // PLAYER TURN - FIRING PHASE
-                UIRenderer::showMessage(1, 82, "                    FIRING!                                    ", 4);
-                refresh();
+                showStatus("FIRING!", 4);
+                refreshScreen(&hud);
                 
-                // Track volley statistics
-                std::vector<std::string> volleyCoords;
-                int missInVolley = 0;
-                int sunkInVolley = 0;
+                engine.beginVolley(shotsSelected);
                 
-                // Send shot count to opponent in multiplayer mode
-                if (!isAI && clientSocket) {
-                    if (!NetworkLogic::sendShotCount(*clientSocket, shotsSelected)) {
-                        clear();
-                        mvprintw(5, 2, "Error: Connection lost!");
-                        mvprintw(6, 2, "Press any key to exit...");
-                        refresh();
-                        getch();
-                        closesocket(*clientSocket);
-                        clear();
-                        return;
+                // Announce the volley to the opponent in multiplayer mode
+                if (!isAI && session) {
+                    while (!session->beginVolley(state.turnNumber, shotsSelected)) {
+                        if (!reconnect(*session, state.turnNumber)) {
+                            showConnectionLost(*session);
+                            return;
+                        }
                     }
                 }
                 
-                // Prepare shot lists for AI and network modes
-                std::vector<AICoordinates> shotsFired;
-                std::vector<coordinates> netShotsFired;
-                
                 // Process each selected shot
                 for (int i = 0; i < shotsSelected; i++) {
                     int shotX = playerShots[i].x;
                     int shotY = playerShots[i].y;
                     
-                    // Format coordinate for display (e.g., "A5")
-                    char coordBuf[16];
-                    sprintf(coordBuf, "%c%d", 'A' + shotX, shotY + 1);
-                    volleyCoords.push_back(std::string(coordBuf));
-                    
-                    int shotResult = 0;
-                    
                     if (isAI) {
                         // Process shot against AI board
-                        AICoordinates shot;
-                        shot.x = shotX;
-                        shot.y = shotY;
-                        shotsFired.push_back(shot);
-                        shotResult = ai->getBoard().receiveShot(shotX, shotY);
+                        engine.firePlayerShot(ai->getBoard(), shotX, shotY);
                     } else {
-                        // Send shot to network opponent
-                        coordinates shot;
-                        shot.x = shotX;
-                        shot.y = shotY;
-                        netShotsFired.push_back(shot);
-                        
-                        if (!NetworkLogic::sendShot(*clientSocket, shot)) {
-                            clear();
-                            mvprintw(5, 2, "Error: Connection lost!");
-                            mvprintw(6, 2, "Press any key to exit...");
-                            refresh();
-                            getch();
-                            closesocket(*clientSocket);
-                            clear();
-                            return;
-                        }
-                        
-                        // Receive shot result from opponent
-                        char answer;
-                        if (!NetworkLogic::receiveShotResult(*clientSocket, answer)) {
-                            clear();
-                            mvprintw(5, 2, "Error: Connection lost!");
-                            mvprintw(6, 2, "Press any key to exit...");
-                            refresh();
-                            getch();
-                            closesocket(*clientSocket);
-                            clear();
-                            return;
-                        }
-                        
-                        // Convert network response to shot result
-                        if (answer == 'm') shotResult = 0;      // miss
-                        else if (answer == 'h') shotResult = 1; // hit
-                        else shotResult = 2;                    // sunk
-                    }
-                    
-                    // Calculate screen position for shot result display
-                    int screenShotY = layout.startY + 3 + shotY;
-                    int screenShotX = layout.board2StartX + 9 + (4 * shotX);
-                    
-                    // Clear shot indicator before displaying result
-                    UIRenderer::clearShotIndicator(screenShotY, screenShotX);
-                    
-                    if (shotResult == 0) {
-                        // MISS - update board with miss marker
-                        missInVolley++;
-                        enemyKnownBoard[shotY][shotX] = 'm';
-                        enemyBoard.boardArray[shotY][shotX] = 'o';
-                        UIRenderer::drawBoardCell(screenShotY, screenShotX, 'o', false);
-                    } else if (shotResult == 1) {
-                        // HIT - update board with hit marker
-                        playerHits++;
-                        enemyKnownBoard[shotY][shotX] = 'h';
-                        enemyBoard.boardArray[shotY][shotX] = 'x';
-                        UIRenderer::drawBoardCell(screenShotY, screenShotX, 'x', false);
-                    } else if (shotResult == 2) {
-                        // SUNK - mark entire ship as sunk
-                        playerHits++;
-                        enemyShipsRemaining--;
-                        sunkInVolley++;
-                        
-                        if (isAI) {
-                            // Get all cells of sunk ship from AI board
-                            auto sunkCells = ai->getBoard().getShipOccupiedCells(shotX, shotY);
-                            for (const auto& cell : sunkCells) {
-                                enemyKnownBoard[cell.second][cell.first] = 's';
-                                enemyBoard.boardArray[cell.second][cell.first] = 's';
-                                int sY = layout.startY + 3 + cell.second;
-                                int sX = layout.board2StartX + 9 + (4 * cell.first);
-                                UIRenderer::drawBoardCell(sY, sX, 's', false);
-                            }
-                        } else {
-                            // For network mode, use flood fill to mark entire ship as sunk
-                            UIRenderer::clearShotIndicator(screenShotY, screenShotX);
-                            
-                            // BFS to find all connected hit cells (same ship)
-                            std::deque<std::pair<int, int>> updateQueue;
-                            updateQueue.push_back({shotX, shotY});
-                            enemyKnownBoard[shotY][shotX] = 's';
-                            enemyBoard.boardArray[shotY][shotX] = 's';
-                            
-                            while (!updateQueue.empty()) {
-                                std::pair<int, int> current = updateQueue.front();
-                                updateQueue.pop_front();
-                                
-                                int cx = current.first;
-                                int cy = current.second;
-                                
-                                // Check all 4 adjacent cells
-                                int dx[] = {0, 0, -1, 1};
-                                int dy[] = {-1, 1, 0, 0};
-                                
-                                for (int k = 0; k < 4; k++) {
-                                    int nx = cx + dx[k];
-                                    int ny = cy + dy[k];
-                                    
-                                    if (nx >= 0 && nx < size && ny >= 0 && ny < size) {
-                                        if (enemyBoard.boardArray[ny][nx] == 'x') {
-                                            // Convert hit to sunk and add to queue
-                                            enemyBoard.boardArray[ny][nx] = 's';
-                                            enemyKnownBoard[ny][nx] = 's';
-                                            
-                                            int updateY = layout.startY + 3 + ny;
-                                            int updateX = layout.board2StartX + 9 + (4 * nx);
-                                            
-                                            UIRenderer::clearShotIndicator(updateY, updateX);
-                                            updateQueue.push_back({nx, ny});
-                                        }
-                                    }
-                                }
-                            }
-                            
-                            // Redraw all sunk cells
-                            for (int r = 0; r < size; r++) {
-                                for (int c = 0; c < size; c++) {
-                                    if (enemyBoard.boardArray[r][c] == 's') {
-                                        int sY = layout.startY + 3 + r;
-                                        int sX = layout.board2StartX + 9 + (4 * c);
-                                        UIRenderer::drawBoardCell(sY, sX, 's', false);
-                                    }
-                                }
+                        // Send shot to network opponent and wait for the result;
+                        // after a reconnect the shot is sent again
+                        int shotResult;
+                        while (!session->fireShot(i, shotX, shotY, shotResult)) {
+                            if (!reconnect(*session, state.turnNumber)) {
+                                showConnectionLost(*session);
+                                return;
                             }
                         }
+                        
+                        engine.resolvePlayerShot(shotX, shotY, shotResult, nullptr);
                     }
                     
-                    refresh();
-                    SLEEP_MS(300);
+                    // Present the shot
+                    drainGameEvents(events, consumers, consumerCount);
+                    refreshScreen(&hud);
+                    pauseFor(session, 300);
                     
                     // Check for victory
-                    if (enemyShipsRemaining <= 0) {
+                    if (engine.isOver()) {
                         break;
                     }
                 }
                 
-                // Count wounded ships (hit but not sunk)
-                int countWounded = 0;
-                if (isAI) {
-                    for (const auto& shot : shotsFired) {
-                        if (ai->getBoard().boardArray[shot.y][shot.x] == 'x') {
-                            countWounded++;
-                        }
-                    }
-                } else {
-                    for (const auto& shot : netShotsFired) {
-                        if (enemyBoard.boardArray[shot.y][shot.x] == 'x') {
-                            countWounded++;
-                        }
-                    }
-                }
-                
-                // Build coordinate string for display
-                std::string coordsStr = "";
-                for (size_t i = 0; i < volleyCoords.size(); i++) {
-                    coordsStr += volleyCoords[i];
-                    if (i < volleyCoords.size() - 1) coordsStr += ",";
-                }
-                
-                // Build statistics string
-                std::string statsStr = " - ";
-                bool hasStats = false;
-                if (countWounded > 0) {
-                    statsStr += std::to_string(countWounded) + " wounded";
-                    hasStats = true;
-                }
-                if (sunkInVolley > 0) {
-                    if (hasStats) statsStr += ", ";
-                    statsStr += std::to_string(sunkInVolley) + " sunk";
-                    hasStats = true;
-                }
-                if (missInVolley > 0) {
-                    if (hasStats) statsStr += ", ";
-                    statsStr += std::to_string(missInVolley) + " miss";
-                }
-                
                 // Display volley results
-                UIRenderer::drawVolleyResult(playerStatsY, layout.board1StartX, coordsStr, statsStr, true);
-                refresh();
+                engine.endVolley();
+                drainGameEvents(events, consumers, consumerCount);
+                refreshScreen(&hud);
                 
                 // Check for player victory
-                if (enemyShipsRemaining <= 0) {
+                if (state.enemyShipsRemaining <= 0) {
                     UIAnimation::drawFirework(true);
-                    if (!isAI && clientSocket) {
-                        closesocket(*clientSocket);
+                    if (!isAI && session) {
+                        session->close();
                     }
                     return;
                 }
@@ -456,183 +475,93 @@ void GameLoop::runGameLoop(
                 // Reset for next turn
                 shotsSelected = 0;
                 selectingMode = true;
-                playerTurn = false;
             }
         } else {
             // ENEMY TURN
-            UIRenderer::showMessage(1, isAI ? 98 : 90, isAI ? " AI's turn...                           " : "         Enemy's turn...                     ", 5);
-            refresh();
-            SLEEP_MS(1000);
+            // A planned AI volley is fired at once; a network volley starts when it arrives
+            AIVolleyPlan plan;
+            bool planned = isAI && aiPlan.valid();
+            if (planned) {
+                plan = aiPlan.get();
+                hud.recordAIDecision(plan.planMs);
+            }
             
-            // Track enemy volley statistics
-            std::vector<std::string> enemyCoords;
-            int missInVolley = 0;
-            int sunkInVolley = 0;
+            showStatus(isAI ? "AI's turn..." : "Enemy's turn...", 5);
+            refreshScreen(&hud);
+            if (isAI && !planned) pauseFor(session, 1000);
             
-            // Receive shot count in multiplayer mode
-            int enemyShotsCount = shots;
+            // Receive the volley announcement in multiplayer mode
+            int enemyShotsCount = planned ? (int)plan.shots.size() : shots;
             if (!isAI) {
-                if (!NetworkLogic::receiveShotCount(*clientSocket, enemyShotsCount)) {
-                    clear();
-                    mvprintw(5, 2, "Error: Connection lost!");
-                    mvprintw(6, 2, "Press any key to exit...");
-                    refresh();
-                    getch();
-                    closesocket(*clientSocket);
-                    clear();
-                    return;
+                int volleySeq;
+                while (!session->receiveVolley(volleySeq, enemyShotsCount)) {
+                    if (!reconnect(*session, state.turnNumber)) {
+                        showConnectionLost(*session);
+                        return;
+                    }
                 }
             }
             
-            // Prepare shot lists for AI and network modes
-            std::vector<AICoordinates> aiShotsFired;
-            std::vector<coordinates> netEnemyShotsFired;
-            
             // Process enemy shots
+            engine.beginVolley(enemyShotsCount);
             for (int i = 0; i < enemyShotsCount; i++) {
                 int shotX, shotY;
                 
-                if (isAI) {
+                if (planned) {
+                    shotX = plan.shots[i].x;
+                    shotY = plan.shots[i].y;
+                } else if (isAI) {
                     // Get AI's attack coordinates
                     AICoordinates shot = ai->pickAttackCoordinates();
                     if (shot.x == -1 || shot.y == -1) break;
-                    aiShotsFired.push_back(shot);
                     shotX = shot.x;
                     shotY = shot.y;
                 } else {
                     // Receive shot from network opponent
-                    coordinates shot;
-                    if (!NetworkLogic::receiveShot(*clientSocket, shot)) {
-                        break;
+                    while (!session->receiveShot(i, shotX, shotY)) {
+                        if (!reconnect(*session, state.turnNumber)) {
+                            showConnectionLost(*session);
+                            return;
+                        }
                     }
-                    netEnemyShotsFired.push_back(shot);
-                    shotX = shot.x;
-                    shotY = shot.y;
                 }
                 
-                // Format coordinate for display
-                char coordBuf[16];
-                sprintf(coordBuf, "%c%d", 'A' + shotX, shotY + 1);
-                enemyCoords.push_back(std::string(coordBuf));
-                
                 // Process shot on player's board
-                int result = playerBoard.receiveShot(shotX, shotY);
-                
-                if (!isAI) {
-                    // Send result back to network opponent
-                    char responseChar;
-                    if (result == 0) {
-                        responseChar = 'm';
-                    } else if (result == 1) {
-                        responseChar = 'h';
-                    } else {
-                        responseChar = 's';
-                    }
-                    NetworkLogic::sendShotResult(*clientSocket, responseChar);
+                int result = engine.resolveEnemyShot(shotX, shotY);
+                if (isAI && !planned) {
+                    ai->recordShotResult(shotX, shotY, result != 0, result == 2);
+                    if (result == 2) ai->recordSunkShip(playerBoard.getShipOccupiedCells(shotX, shotY));
                 }
                 
-                // Calculate screen position for display
-                int screenShotY = layout.startY + 3 + shotY;
-                int screenShotX = layout.board1StartX + 5 + (4 * shotX);
-                
-                if (result == 0) {
-                    // MISS
-                    missInVolley++;
-                    if (isAI) {
-                        ai->recordShotResult(shotX, shotY, false, false);
-                    }
-                    UIRenderer::drawBoardCell(screenShotY, screenShotX, 'o', true);
-                } else if (result == 1) {
-                    // HIT
-                    enemyHits++;
-                    if (isAI) {
-                        ai->recordShotResult(shotX, shotY, true, false);
-                    }
-                    UIRenderer::drawBoardCell(screenShotY, screenShotX, 'x', true);
-                } else {
-                    // SUNK
-                    enemyHits++;
-                    playerShipsRemaining--;
-                    sunkInVolley++;
-                    if (isAI) {
-                        ai->recordShotResult(shotX, shotY, true, true);
-                    }
-                    
-                    // Redraw all sunk cells of the ship
-                    for (int r = 0; r < size; r++) {
-                        for (int c = 0; c < size; c++) {
-                            if (playerBoard.boardArray[r][c] == 's') {
-                                int sY = layout.startY + 3 + r;
-                                int sX = layout.board1StartX + 5 + (4 * c);
-                                UIRenderer::drawBoardCell(sY, sX, 's', true);
-                            }
-                        }
-                    }
-                }
-                refresh();
-                SLEEP_MS(300);
+                // Answer (network) and present the shot
+                drainGameEvents(events, consumers, consumerCount);
+                refreshScreen(&hud);
+                pauseFor(session, 300);
                 
                 // Check for enemy victory
-                if (playerShipsRemaining <= 0) {
+                if (engine.isOver()) {
                     break;
                 }
             }
             
-            // Count wounded ships
-            int countWounded = 0;
-            if (isAI) {
-                for (const auto& shot : aiShotsFired) {
-                    if (playerBoard.boardArray[shot.y][shot.x] == 'x') {
-                        countWounded++;
-                    }
-                }
-            } else {
-                for (const auto& shot : netEnemyShotsFired) {
-                    if (playerBoard.boardArray[shot.y][shot.x] == 'x') {
-                        countWounded++;
-                    }
-                }
-            }
-            
-            // Build coordinate string
-            std::string eCoordsStr = "";
-            for (size_t i = 0; i < enemyCoords.size(); i++) {
-                eCoordsStr += enemyCoords[i];
-                if (i < enemyCoords.size() - 1) eCoordsStr += ",";
-            }
-            
-            // Build statistics string
-            std::string eStatsStr = " - ";
-            bool eHasStats = false;
-            if (countWounded > 0) {
-                eStatsStr += std::to_string(countWounded) + " wounded";
-                eHasStats = true;
-            }
-            if (sunkInVolley > 0) {
-                if (eHasStats) eStatsStr += ", ";
-                eStatsStr += std::to_string(sunkInVolley) + " sunk";
-                eHasStats = true;
-            }
-            if (missInVolley > 0) {
-                if (eHasStats) eStatsStr += ", ";
-                eStatsStr += std::to_string(missInVolley) + " miss";
+            // The planner already recorded every result
+            if (planned) {
+                ai->adoptTargeting(*plan.after);
             }
             
             // Display enemy volley results
-            UIRenderer::drawVolleyResult(enemyStatsY, layout.board1StartX, eCoordsStr, eStatsStr, false);
-            refresh();
+            engine.endVolley();
+            drainGameEvents(events, consumers, consumerCount);
+            refreshScreen(&hud);
             
             // Check for enemy victory (player loss)
-            if (playerShipsRemaining <= 0) {
+            if (state.playerShipsRemaining <= 0) {
                 UIAnimation::drawFirework(false);
-                if (!isAI && clientSocket) {
-                    closesocket(*clientSocket);
+                if (!isAI && session) {
+                    session->close();
                 }
                 return;
             }
-            
-            // Switch back to player turn
-            playerTurn = true;
         }
     }
 }
\ No newline at end of file
@@ -17,31 +17,26 @@
 #include "../ui/ui_config.hpp"
 #include <vector>
 
+class SpectatorHub;
+class ShotHistory;
+
 // Main class managing the game loop
 class GameLoop {
 public:
     // Main game loop function that handles turn-based gameplay
-    // playerBoard: player's own board with ships
-    // enemyBoard: opponent's board (hidden from player)
-    // enemyKnownBoard: player's view of enemy board (fog of war)
-    // size: board dimensions (NxN)
-    // shots: number of shots allowed per turn
-    // playerTurn: true if it's player's turn
+    // state: boards, fog of war, counters and turn; updated in place once per shot
     // isAI: true if playing against AI, false for network game
     // aiPtr: pointer to AILogic object (if AI game)
     // socketPtr: pointer to socket (if network game)
-    // isHost: true if player is host in network game
+    // spectators: broadcast channel for observers (host only), or nullptr
+    // shotHistory: records the player's shots for the AI's next placement, or nullptr
     static void runGameLoop(
-        BoardData& playerBoard,
-        BoardData& enemyBoard,
-        std::vector<std::vector<char>>& enemyKnownBoard,
-        int size,
-        int shots,
-        bool playerTurn,
+        GameState& state,
         bool& isAI,
         void* aiPtr,
         void* socketPtr,
-        bool isHost
+        SpectatorHub* spectators = nullptr,
+        ShotHistory* shotHistory = nullptr
     );
 
 private:
@@ -13,9 +13,11 @@
 #include "game_controller.hpp"
 #include "../ui/ui_renderer.hpp"
 #include "../ui/ui_config.hpp"
-#include "../logic/network_logic.hpp"
+#include "../logic/net_session.hpp"
+#include "../logic/spectator_hub.hpp"
 #include "../logic/game_logic.hpp"
 #include "../data/ship_data.hpp"
+#include <chrono>
 #include <cstring>
 #include <vector>
 
@@ -86,18 +88,32 @@ void playMultiplayerHost() {
         }
     }
     
+    // Open a session; the host socket stays open so the client can reconnect
+    NetSession session;
+    if (!session.startHost(hostSocket, clientSocket)) {
+        clear();
+        mvprintw(5, 2, "Error: Connection lost!");
+        mvprintw(6, 2, "Press any key to exit...");
+        refresh();
+        getch();
+        session.close();
+        closesocket(hostSocket);
+        clear();
+        return;
+    }
+    
     // Host selects game settings
     int size = getBoardSize();
     int shots = UIRenderer::selectShotsPerTurn(size);
     
     // Send game settings to client
-    if (!NetworkLogic::sendGameSettings(clientSocket, size, shots)) {
+    if (!NetworkLogic::sendGameSettings(session.getSocket(), size, shots)) {
         clear();
         mvprintw(5, 2, "Error: Connection lost!");
         mvprintw(6, 2, "Press any key to exit...");
         refresh();
         getch();
-        closesocket(clientSocket);
+        session.close();
         closesocket(hostSocket);
         clear();
         return;
@@ -110,11 +126,18 @@ void playMultiplayerHost() {
     mvprintw(2, 2, "Multiplayer Game (Host)");
     mvprintw(3, 2, "Board: %dx%d | Shots: %d per turn", size, size, shots);
     mvprintw(4, 2, "Waiting for client to setup board...");
+    
+    // Open the spectator channel; the match is played the same without it
+    SpectatorHub spectators;
+    if (spectators.start(SPECTATOR_PORT, size, shots)) {
+        mvprintw(5, 2, "Spectators can watch on port %d", SPECTATOR_PORT);
+    }
     refresh();
     
     // Initialize boards
-    BoardData playerBoard(size);
-    BoardData enemyBoard(size);
+    GameState state;
+    GameLogic::initializeGame(state, size, shots, true);
+    BoardData& playerBoard = state.playerBoard;
     
     // Host sets up their board
     int boardResult = 0;
@@ -123,156 +146,62 @@ void playMultiplayerHost() {
 
         // Manual placement mode handling
         if (boardResult == 0) {
-            BoardLayout layout = calculateBoardLayout(size);
-            std::vector<GamePiece> pieces;
-            GameLogic::initializeGamePieces(playerBoard, pieces);
-            
-            // Manual ship placement variables
-            int shipToPlace = 0;
-            int orientation = 0;  // 0 = horizontal, 1 = vertical
-            int cursorX = layout.board1StartX + 5;
-            int cursorY = layout.startY + 3;
-            int maxCursorX = layout.board1StartX + 5 + (size - 1) * 4;
-            int maxCursorY = layout.startY + 3 + size - 1;
-            
-            // Ship placement loop
-            while (shipToPlace < (int)pieces.size()) {
-                UIRenderer::drawManualBoard(layout, playerBoard);
-                
-                GamePiece ship = pieces[shipToPlace];
-                bool isValid = false;
-                
-                // Highlight current ship placement position
-                UIRenderer::highlightShipPlacement(layout, cursorX, cursorY, 
-                    ship.Get_Piece_Length(), orientation, ship.Get_Piece_Symbol(),
-                    playerBoard, isValid);
-                
-                refresh();
-                
-                // Handle user input for ship placement
-                int ch = getch();
-                int gridX = (cursorX - layout.board1StartX - 5) / 4;
-                int gridY = cursorY - layout.startY - 3;
-                
-                switch (ch) {
-                    case KEY_LEFT:
-                    case 'a':
-                    case 'A':
-                        // Move cursor left with boundary checking
-                        if (orientation == 0) {
-                            if ((cursorX - (4 * (ship.Get_Piece_Length() - 1))) > layout.board1StartX + 5) {
-                                cursorX -= 4;
-                            }
-                        } else {
-                            if (cursorX > layout.board1StartX + 5) {
-                                cursorX -= 4;
-                            }
-                        }
-                        break;
-                    case KEY_RIGHT:
-                    case 'd':
-                    case 'D':
-                        // Move cursor right
-                        if (cursorX < maxCursorX) {
-                            cursorX += 4;
-                        }
-                        break;
-                    case KEY_UP:
-                    case 'w':
-                    case 'W':
-                        // Move cursor up with boundary checking
-                        if (orientation == 1) {
-                            if ((cursorY - (ship.Get_Piece_Length() - 1)) > layout.startY + 3) {
-                                cursorY -= 1;
-                            }
-                        } else {
-                            if (cursorY > layout.startY + 3) {
-                                cursorY -= 1;
-                            }
-                        }
-                        break;
-                    case KEY_DOWN:
-                    case 's':
-                    case 'S':
-                        // Move cursor down
-                        if (cursorY < maxCursorY) {
-                            cursorY += 1;
-                        }
-                        break;
-                    case 'r':
-                    case 'R':
-                        // Rotate ship orientation
-                        if (orientation == 0) {
-                            if ((cursorY - (ship.Get_Piece_Length() - 1)) >= layout.startY + 3) {
-                                orientation = 1;
-                            }
-                        } else {
-                            if ((cursorX - (4 * (ship.Get_Piece_Length() - 1))) >= layout.board1StartX + 5) {
-                                orientation = 0;
-                            }
-                        }
-                        break;
-                    case 'g':
-                    case 'G':
-                        // Return to auto-generation mode
-                        boardResult = -1;
-                        shipToPlace = pieces.size();
-                        break;
-                    case ' ':
-                    case 10:  // Enter key
-                        // Place ship if position is valid
-                        if (isValid) {
-                            if (GameLogic::placeShip(playerBoard, gridX, gridY, orientation, 
-                                ship.Get_Piece_Length(), ship.Get_Piece_Symbol())) {
-                                shipToPlace++;
-                                cursorY = layout.startY + 3;
-                                cursorX = layout.board1StartX + 5;
-                            }
-                        }
-                        break;
-                }
-            }
-            
-            // If user pressed 'G' to regenerate, skip confirmation
-            if (boardResult == -1) {
-                continue;
-            }
-            
-            // Build ship cell map and confirm placement
-            playerBoard.buildShipCellMap();
-            if (UIRenderer::confirmBoardPlacement()) {
-                boardResult = 1;
-            }
+            boardResult = placeShipsManually(playerBoard, size);
         }
     }
     
-    // Initialize enemy board tracking (fog of war)
-    std::vector<std::vector<char>> enemyKnownBoard(size, std::vector<char>(size, ' '));
-    
     // Configure game mode parameters
     bool isAI = false;
     void* aiPtr = nullptr;
-    void* socketPtr = &clientSocket;
+    void* socketPtr = &session;
     
     // Start main game loop (host goes first)
-    GameLoop::runGameLoop(
-        playerBoard,
-        enemyBoard,
-        enemyKnownBoard,
-        size,
-        shots,
-        true,        // playerTurn = true (host starts)
-        isAI,
-        aiPtr,
-        socketPtr,
-        true         // isHost = true
-    );
+    GameLoop::runGameLoop(state, isAI, aiPtr, socketPtr, &spectators);
+    if (!g_gameSettings.netStatsPath.empty()) {
+        writeNetStatsJson(session.getStats(), session.getSessionId(), g_gameSettings.netStatsPath);
+    }
     
     // Cleanup
     closesocket(hostSocket);
     clear();
 }
 
+// Resolve and connect while the screen stays responsive
+SOCKET_TYPE connectToHost(const char* hostname, int port) {
+    static const char spinner[] = "|/-\\";
+    int frame = 0;
+    
+    // Name lookup can take seconds; poll it so the user can give up
+    std::future<std::vector<NetAddress>> lookup = NetworkLogic::resolveAsync(hostname, port);
+    nodelay(stdscr, TRUE);
+    while (lookup.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready) {
+        mvprintw(8, 2, "Resolving %s... %c  (q - cancel)", hostname, spinner[frame++ % 4]);
+        refresh();
+        int key = getch();
+        if (key == 'q' || key == 'Q' || key == 27) {
+            nodelay(stdscr, FALSE);
+            move(8, 2);
+            clrtoeol();
+            return INVALID_SOCKET_VALUE;
+        }
+    }
+    nodelay(stdscr, FALSE);
+    
+    std::vector<NetAddress> addresses = lookup.get();
+    move(8, 2);
+    clrtoeol();
+    if (addresses.empty()) {
+        return INVALID_SOCKET_VALUE;
+    }
+    
+    mvprintw(8, 2, "Connecting to %s...", hostname);
+    refresh();
+    SOCKET_TYPE sock = NetworkLogic::connectFirst(addresses);
+    move(8, 2);
+    clrtoeol();
+    return sock;
+}
+
 // Client multiplayer game - connects to host, receives game settings,
 // sets up board, and starts the game with client going second
 void playMultiplayerClient() {
@@ -291,10 +220,9 @@ void playMultiplayerClient() {
 
     // Attempt connection to host
     clear();
-    mvprintw(8, 2, "Connecting to %s...", hostname);
     refresh();
 
-    SOCKET_TYPE clientSocket = NetworkLogic::createClientSocket(hostname);
+    SOCKET_TYPE clientSocket = connectToHost(hostname, PORT);
     if (clientSocket == INVALID_SOCKET_VALUE) {
         mvprintw(8, 2, "Connection failed. Is the Host started?");
         mvprintw(10, 2, "Press any key to return...");
@@ -304,18 +232,20 @@ void playMultiplayerClient() {
         return;
     }
 
-    // Wait for host to send game settings
+    // Wait for host to accept the session and send game settings
     mvprintw(8, 2, "Connected! Waiting for host to start game...");
     refresh();
 
+    NetSession session;
     int size, shots;
-    if (!NetworkLogic::receiveGameSettings(clientSocket, size, shots)) {
+    if (!session.startClient(hostname, clientSocket) ||
+        !NetworkLogic::receiveGameSettings(session.getSocket(), size, shots)) {
         clear();
         mvprintw(5, 2, "Error: Connection lost!");
         mvprintw(6, 2, "Press any key to exit...");
         refresh();
         getch();
-        closesocket(clientSocket);
+        session.close();
         clear();
         return;
     }
@@ -334,8 +264,9 @@ void playMultiplayerClient() {
     setBoardSize(size);
 
     // Initialize boards
-    BoardData playerBoard(size);
-    BoardData enemyBoard(size);
+    GameState state;
+    GameLogic::initializeGame(state, size, shots, false);
+    BoardData& playerBoard = state.playerBoard;
 
     // Client sets up their board
     int boardResult = 0;
@@ -344,150 +275,20 @@ void playMultiplayerClient() {
 
         // Manual placement mode handling
         if (boardResult == 0) {
-            BoardLayout layout = calculateBoardLayout(size);
-            std::vector<GamePiece> pieces;
-            GameLogic::initializeGamePieces(playerBoard, pieces);
-            
-            // Manual ship placement variables
-            int shipToPlace = 0;
-            int orientation = 0;  // 0 = horizontal, 1 = vertical
-            int cursorX = layout.board1StartX + 5;
-            int cursorY = layout.startY + 3;
-            int maxCursorX = layout.board1StartX + 5 + (size - 1) * 4;
-            int maxCursorY = layout.startY + 3 + size - 1;
-            
-            // Ship placement loop
-            while (shipToPlace < (int)pieces.size()) {
-                UIRenderer::drawManualBoard(layout, playerBoard);
-                
-                GamePiece ship = pieces[shipToPlace];
-                bool isValid = false;
-                
-                // Highlight current ship placement position
-                UIRenderer::highlightShipPlacement(layout, cursorX, cursorY, 
-                    ship.Get_Piece_Length(), orientation, ship.Get_Piece_Symbol(),
-                    playerBoard, isValid);
-                
-                refresh();
-                
-                // Handle user input for ship placement
-                int ch = getch();
-                int gridX = (cursorX - layout.board1StartX - 5) / 4;
-                int gridY = cursorY - layout.startY - 3;
-                
-                switch (ch) {
-                    case KEY_LEFT:
-                    case 'a':
-                    case 'A':
-                        // Move cursor left with boundary checking
-                        if (orientation == 0) {
-                            if ((cursorX - (4 * (ship.Get_Piece_Length() - 1))) > layout.board1StartX + 5) {
-                                cursorX -= 4;
-                            }
-                        } else {
-                            if (cursorX > layout.board1StartX + 5) {
-                                cursorX -= 4;
-                            }
-                        }
-                        break;
-                    case KEY_RIGHT:
-                    case 'd':
-                    case 'D':
-                        // Move cursor right
-                        if (cursorX < maxCursorX) {
-                            cursorX += 4;
-                        }
-                        break;
-                    case KEY_UP:
-                    case 'w':
-                    case 'W':
-                        // Move cursor up with boundary checking
-                        if (orientation == 1) {
-                            if ((cursorY - (ship.Get_Piece_Length() - 1)) > layout.startY + 3) {
-                                cursorY -= 1;
-                            }
-                        } else {
-                            if (cursorY > layout.startY + 3) {
-                                cursorY -= 1;
-                            }
-                        }
-                        break;
-                    case KEY_DOWN:
-                    case 's':
-                    case 'S':
-                        // Move cursor down
-                        if (cursorY < maxCursorY) {
-                            cursorY += 1;
-                        }
-                        break;
-                    case 'r':
-                    case 'R':
-                        // Rotate ship orientation
-                        if (orientation == 0) {
-                            if ((cursorY - (ship.Get_Piece_Length() - 1)) >= layout.startY + 3) {
-                                orientation = 1;
-                            }
-                        } else {
-                            if ((cursorX - (4 * (ship.Get_Piece_Length() - 1))) >= layout.board1StartX + 5) {
-                                orientation = 0;
-                            }
-                        }
-                        break;
-                    case 'g':
-                    case 'G':
-                        // Return to auto-generation mode
-                        boardResult = -1;
-                        shipToPlace = pieces.size();
-                        break;
-                    case ' ':
-                    case 10:  // Enter key
-                        // Place ship if position is valid
-                        if (isValid) {
-                            if (GameLogic::placeShip(playerBoard, gridX, gridY, orientation, 
-                                ship.Get_Piece_Length(), ship.Get_Piece_Symbol())) {
-                                shipToPlace++;
-                                cursorY = layout.startY + 3;
-                                cursorX = layout.board1StartX + 5;
-                            }
-                        }
-                        break;
-                }
-            }
-            
-            // If user pressed 'G' to regenerate, skip confirmation
-            if (boardResult == -1) {
-                continue;
-            }
-            
-            // Build ship cell map and confirm placement
-            playerBoard.buildShipCellMap();
-            if (UIRenderer::confirmBoardPlacement()) {
-                boardResult = 1;
-            }
+            boardResult = placeShipsManually(playerBoard, size);
         }
     }
 
-    // Initialize enemy board tracking (fog of war)
-    std::vector<std::vector<char>> enemyKnownBoard(size, std::vector<char>(size, ' '));
-
     // Configure game mode parameters
     bool isAI = false;
     void* aiPtr = nullptr;
-    void* socketPtr = &clientSocket;
+    void* socketPtr = &session;
 
-    // Start main game loop (client goes second)
-    GameLoop::runGameLoop(
-        playerBoard,
-        enemyBoard,
-        enemyKnownBoard,
-        size,
-        shots,
-        false,       // playerTurn = false (client waits)
-        isAI,
-        aiPtr,
-        socketPtr,
-        false        // isHost = false
-    );
+    // Start main game loop (client goes second, state.playerTurn is false)
+    GameLoop::runGameLoop(state, isAI, aiPtr, socketPtr);
+    if (!g_gameSettings.netStatsPath.empty()) {
+        writeNetStatsJson(session.getStats(), session.getSessionId(), g_gameSettings.netStatsPath);
+    }
 
     clear();
 }
\ No newline at end of file
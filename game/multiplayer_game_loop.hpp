@@ -11,6 +11,8 @@
 #ifndef MULTIPLAYER_GAME_LOOP_HPP
 #define MULTIPLAYER_GAME_LOOP_HPP
 
+#include "../logic/network_logic.hpp"
+
 // Function to host a multiplayer game
 // Creates a server socket, waits for client connection,
 // negotiates game settings, and starts the game loop
@@ -21,4 +23,8 @@ void playMultiplayerHost();
 // and starts the game loop
 void playMultiplayerClient();
 
+// Resolve hostname off the UI thread and connect to the first address that answers
+// Shows progress on screen; q or Esc cancels. Returns INVALID_SOCKET_VALUE on failure.
+SOCKET_TYPE connectToHost(const char* hostname, int port);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,397 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: simulation.cpp
+ * Description: Implementation of the headless AI vs AI simulator and its command
+ *              line entry point.
+ */
+
+#include "simulation.hpp"
+#include "../logic/target_prior.hpp"
+#include "../logic/game_logic.hpp"
+#include "../logic/turn_engine.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+// Play one AI vs AI game, both sides firing the fleet's shots per turn
+SimulationResult simulateGame(AIDifficulty first, AIDifficulty second,
+                              const FleetConfig& fleet, SessionArena* arena, unsigned long long seed) {
+    return simulateGame(first, fleet.shotsPerTurn, second, fleet.shotsPerTurn, fleet, arena, seed);
+}
+
+// Play one AI vs AI game through the turn engine, alternating full volleys like runGameLoop
+// The state is kept from the first AI's side: its fleet is the player board
+SimulationResult simulateGame(AIDifficulty first, int firstShots, AIDifficulty second, int secondShots,
+                              const FleetConfig& fleet, SessionArena* arena, unsigned long long seed) {
+    GameRng seeds(seed);
+    AILogic firstAI(first, fleet, arena, seeds());
+    AILogic secondAI(second, fleet, arena, seeds());
+    AILogic* players[2] = { &firstAI, &secondAI };
+    int shotsPerTurn[2] = { firstShots, secondShots };
+
+    GameState state(arena);
+    GameLogic::initializeGame(state, fleet, true);
+    state.playerBoard = firstAI.getBoard();
+    BoardData* boards[2] = { &secondAI.getBoard(), &state.playerBoard };
+
+    // No ring attached: the engine resolves shots without emitting events
+    TurnEngine engine(state);
+
+    SimulationResult result;
+    result.winner = -1;
+    result.turns = 0;
+    result.shotsFirst = 0;
+    result.shotsSecond = 0;
+
+    while (result.winner < 0) {
+        int side = state.playerTurn ? 0 : 1;
+        AILogic& shooter = *players[side];
+        BoardData& target = *boards[side];
+
+        int fired = 0;
+        engine.beginVolley(shotsPerTurn[side]);
+        while (fired < shotsPerTurn[side] && !engine.isOver()) {
+            AICoordinates shot = shooter.pickAttackCoordinates();
+            if (shot.x == -1 || shot.y == -1) break;
+
+            int shotResult = (side == 0) ? engine.firePlayerShot(target, shot.x, shot.y)
+                                         : engine.resolveEnemyShot(shot.x, shot.y);
+            shooter.recordShotResult(shot.x, shot.y, shotResult != 0, shotResult == 2);
+            if (shotResult == 2) shooter.recordSunkShip(target.getShipOccupiedCells(shot.x, shot.y));
+            fired++;
+        }
+
+        if (side == 0) {
+            result.shotsFirst += fired;
+        } else {
+            result.shotsSecond += fired;
+        }
+        result.turns++;
+
+        if (engine.isOver()) {
+            result.winner = (state.enemyShipsRemaining <= 0) ? 0 : 1;
+        } else if (fired == 0) {
+            // Shooter ran out of targets - only possible with an unsinkable board
+            result.winner = 1 - side;
+        }
+        engine.endVolley();
+    }
+    return result;
+}
+
+// Play a batch of games, reclaiming all per-game memory with one arena reset
+SimulationSummary runSimulation(AIDifficulty first, AIDifficulty second,
+                                const FleetConfig& fleet, int games) {
+    SimulationSummary summary;
+    SessionArena arena;
+    GameRng seeds(makeAISeed());
+
+    for (int g = 0; g < games; g++) {
+        SimulationResult result = simulateGame(first, second, fleet, &arena, seeds());
+
+        summary.games++;
+        if (result.winner == 0) {
+            summary.winsFirst++;
+        } else {
+            summary.winsSecond++;
+        }
+        summary.totalTurns += result.turns;
+        summary.totalShots += result.shotsFirst + result.shotsSecond;
+        summary.winnerShots += (result.winner == 0) ? result.shotsFirst : result.shotsSecond;
+        if (arena.getBytesUsed() > summary.arenaBytesPeak) {
+            summary.arenaBytesPeak = arena.getBytesUsed();
+        }
+
+        arena.reset();
+    }
+
+    summary.arenaCapacity = arena.getCapacity();
+    return summary;
+}
+
+// Parse "easy" / "smart" (case-sensitive), defaulting to SMART
+AIDifficulty parseDifficulty(const char* name) {
+    return (strcmp(name, "easy") == 0) ? EASY : SMART;
+}
+
+// Command line entry: --simulate <games> [easy|smart] [easy|smart] [fleet file]
+int runSimulationCommand(int argc, char** argv) {
+    int games = (argc > 2) ? atoi(argv[2]) : 100;
+    AIDifficulty first = (argc > 3) ? parseDifficulty(argv[3]) : SMART;
+    AIDifficulty second = (argc > 4) ? parseDifficulty(argv[4]) : SMART;
+
+    FleetConfig fleet = getFleetConfig(10);
+    if (argc > 5) {
+        std::string error;
+        if (!loadFleetConfig(argv[5], fleet, error)) {
+            printf("Fleet error: %s\n", error.c_str());
+            return 1;
+        }
+    }
+    if (games < 1) {
+        printf("Usage: %s --simulate <games> [easy|smart] [easy|smart] [fleet file]\n", argv[0]);
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    SimulationSummary summary = runSimulation(first, second, fleet, games);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("Games:          %d (%dx%d board, %d ships, %d shots/turn)\n",
+           summary.games, fleet.boardSize, fleet.boardSize, fleet.getTotalShips(), fleet.shotsPerTurn);
+    printf("First AI wins:  %d\n", summary.winsFirst);
+    printf("Second AI wins: %d\n", summary.winsSecond);
+    printf("Avg turns:      %.2f\n", (double)summary.totalTurns / summary.games);
+    printf("Avg shots:      %.2f\n", (double)summary.totalShots / summary.games);
+    printf("Shots to win:   %.2f\n", (double)summary.winnerShots / summary.games);
+    printf("Arena peak:     %zu bytes/game (%zu reserved)\n", summary.arenaBytesPeak, summary.arenaCapacity);
+    printf("Time:           %.3f s (%.1f games/s)\n", seconds, seconds > 0 ? summary.games / seconds : 0.0);
+    return 0;
+}
+
+// e.g. "smart 10x10 3/turn"
+std::string ladderConfigName(const LadderConfig& config) {
+    char name[64];
+    snprintf(name, sizeof(name), "%s %dx%d %d/turn", config.difficulty == EASY ? "easy" : "smart",
+             config.boardSize, config.boardSize, config.shotsPerTurn);
+    return name;
+}
+
+// One worker's share of a rating period: random same-size pairings, random first shooter
+static void playLadderGames(const std::vector<LadderConfig>& configs, const std::vector<FleetConfig>& fleets,
+                            long long games, unsigned long long seed, RatingShard& shard) {
+    SessionArena arena;
+    GameRng rng(seed);
+    std::uniform_int_distribution<int> pick(0, (int)configs.size() - 1);
+    for (long long g = 0; g < games; g++) {
+        int a = pick(rng);
+        int b = a;
+        for (int tries = 0; tries < 64 && (b == a || configs[b].boardSize != configs[a].boardSize); tries++) {
+            b = pick(rng);
+        }
+        if (b == a || configs[b].boardSize != configs[a].boardSize) continue;
+
+        const LadderConfig& ca = configs[a];
+        const LadderConfig& cb = configs[b];
+        SimulationResult result = simulateGame(ca.difficulty, ca.shotsPerTurn, cb.difficulty, cb.shotsPerTurn,
+                                               fleets[a], &arena, rng());
+        shard.recordGame(a, b, result.winner == 0 ? 1.0 : 0.0);
+        arena.reset();
+    }
+}
+
+// Rating periods of gamesPerPeriod games, each split across the worker threads
+void runLadder(RatingLadder& ladder, const std::vector<LadderConfig>& configs,
+               long long games, int threads, int gamesPerPeriod) {
+    std::vector<FleetConfig> fleets;
+    for (const LadderConfig& config : configs) {
+        FleetConfig fleet = getFleetConfig(config.boardSize);
+        fleet.shotsPerTurn = config.shotsPerTurn;
+        fleets.push_back(fleet);
+    }
+    if (threads < 1) threads = 1;
+    if (gamesPerPeriod < threads) gamesPerPeriod = threads;
+
+    std::vector<RatingShard> shards(threads, ladder.newShard());
+    GameRng seeds(makeAISeed());
+    for (long long played = 0; played < games; played += gamesPerPeriod) {
+        long long period = std::min<long long>(gamesPerPeriod, games - played);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            long long share = period / threads + (t < period % threads ? 1 : 0);
+            workers.push_back(std::thread(playLadderGames, std::cref(configs), std::cref(fleets),
+                                          share, seeds(), std::ref(shards[t])));
+        }
+        for (std::thread& worker : workers) worker.join();
+
+        for (RatingShard& shard : shards) {
+            ladder.merge(shard);
+            shard.clear();
+        }
+        ladder.endPeriod();
+    }
+}
+
+// Command line entry: --ladder <games> [threads] [board size]...
+int runLadderCommand(int argc, char** argv) {
+    long long games = (argc > 2) ? atoll(argv[2]) : 0;
+    int threads = (argc > 3) ? atoi(argv[3]) : (int)std::thread::hardware_concurrency();
+    if (games < 1 || threads < 1 || threads > 256) {
+        printf("Usage: %s --ladder <games> [threads] [board size]...\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<int> sizes;
+    for (int i = 4; i < argc; i++) {
+        int size = atoi(argv[i]);
+        if (getShipConfig(size).boardSize != size) {
+            printf("No standard fleet for board size %d\n", size);
+            return 1;
+        }
+        sizes.push_back(size);
+    }
+    if (sizes.empty()) sizes.push_back(10);
+
+    const int shotOptions[] = { 1, 3, 5 };
+    std::vector<LadderConfig> configs;
+    RatingLadder ladder;
+    for (int size : sizes) {
+        for (int difficulty = EASY; difficulty <= SMART; difficulty++) {
+            for (int shots : shotOptions) {
+                LadderConfig config = { (AIDifficulty)difficulty, size, shots };
+                configs.push_back(config);
+                ladder.addPlayer(ladderConfigName(config));
+            }
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    runLadder(ladder, configs, games, threads, LADDER_GAMES_PER_PERIOD);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("Ladder:         %lld games, %d periods, %d threads\n", games, ladder.getPeriods(), threads);
+    printf("Time:           %.3f s (%.1f games/s)\n", seconds, seconds > 0 ? games / seconds : 0.0);
+
+    // Best first within each board size; ratings are only comparable within a size
+    std::vector<int> order;
+    for (int i = 0; i < ladder.getPlayerCount(); i++) order.push_back(i);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        if (configs[a].boardSize != configs[b].boardSize) return configs[a].boardSize < configs[b].boardSize;
+        return ladder.getPlayer(a).rating > ladder.getPlayer(b).rating;
+    });
+    printf("\n%-22s %8s %21s %10s %7s\n", "Configuration", "Rating", "95% interval", "Games", "Score");
+    for (int id : order) {
+        const PlayerRating& player = ladder.getPlayer(id);
+        double margin = GLICKO_INTERVAL_Z * player.rd;
+        printf("%-22s %8.1f  [%8.1f, %8.1f] %10lld %6.1f%%\n", player.name.c_str(), player.rating,
+               player.rating - margin, player.rating + margin, player.games,
+               player.games > 0 ? 100.0 * player.score / player.games : 0.0);
+    }
+    return 0;
+}
+
+// Self-play with an arena per row; memory per row is two sketches whatever the game count
+void runShotReport(const std::vector<int>& sizes, int games, std::vector<ShotReportRow>& rows,
+                   unsigned long long seed) {
+    SessionArena arena;
+    GameRng seeds(seed);
+    for (int size : sizes) {
+        FleetConfig fleet = getFleetConfig(size);
+        for (int difficulty = EASY; difficulty <= SMART; difficulty++) {
+            ShotReportRow row;
+            row.boardSize = size;
+            row.difficulty = (AIDifficulty)difficulty;
+            for (int g = 0; g < games; g++) {
+                SimulationResult result = simulateGame(row.difficulty, row.difficulty, fleet, &arena, seeds());
+                bool firstWon = result.winner == 0;
+                row.shots.add(firstWon ? result.shotsFirst : result.shotsSecond);
+                row.volleys.add(firstWon ? (result.turns + 1) / 2 : result.turns / 2);
+                arena.reset();
+            }
+            rows.push_back(row);
+        }
+    }
+}
+
+static const double REPORT_QUANTILES[] = { 0.10, 0.25, 0.50, 0.75, 0.90, 0.99 };
+
+bool writeShotReport(const std::string& path, const std::vector<ShotReportRow>& rows) {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    fprintf(file, "board_size,difficulty,metric,games,mean,min,p10,p25,p50,p75,p90,p99,max\n");
+    for (const ShotReportRow& row : rows) {
+        for (int metric = 0; metric < 2; metric++) {
+            const QuantileSketch& sketch = metric == 0 ? row.shots : row.volleys;
+            fprintf(file, "%d,%s,%s,%lld,%.2f,%.0f", row.boardSize, row.difficulty == EASY ? "easy" : "smart",
+                    metric == 0 ? "shots" : "volleys", sketch.getCount(), sketch.getMean(), sketch.getMin());
+            for (double q : REPORT_QUANTILES) fprintf(file, ",%.1f", sketch.quantile(q));
+            fprintf(file, ",%.0f\n", sketch.getMax());
+        }
+    }
+    return fclose(file) == 0;
+}
+
+bool writeShotHistogram(const std::string& path, const std::vector<ShotReportRow>& rows) {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    fprintf(file, "board_size,difficulty,metric,lower,upper,games\n");
+    for (const ShotReportRow& row : rows) {
+        for (int metric = 0; metric < 2; metric++) {
+            const QuantileSketch& sketch = metric == 0 ? row.shots : row.volleys;
+            for (int i = 0; i < sketch.getBucketCount(); i++) {
+                if (sketch.getBucketValues(i) == 0) continue;
+                fprintf(file, "%d,%s,%s,%.2f,%.2f,%lld\n", row.boardSize, row.difficulty == EASY ? "easy" : "smart",
+                        metric == 0 ? "shots" : "volleys", sketch.getBucketLower(i), sketch.getBucketUpper(i),
+                        sketch.getBucketValues(i));
+            }
+        }
+    }
+    return fclose(file) == 0;
+}
+
+// Command line entry: --shot-report <games> [percentiles csv] [histogram csv]
+int runShotReportCommand(int argc, char** argv) {
+    int games = (argc > 2) ? atoi(argv[2]) : 0;
+    if (games < 1) {
+        printf("Usage: %s --shot-report <games> [percentiles csv] [histogram csv]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<int> sizes;
+    for (int size = 1; size <= FLEET_MAX_BOARD_SIZE; size++) {
+        if (getShipConfig(size).boardSize == size) sizes.push_back(size);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ShotReportRow> rows;
+    runShotReport(sizes, games, rows, makeAISeed());
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%-6s %-6s %7s | %-30s | %-20s\n", "Board", "AI", "Games", "Shots to win  mean  p50  p90  p99",
+           "Volleys  p50  p90  p99");
+    for (const ShotReportRow& row : rows) {
+        printf("%2dx%-3d %-6s %7lld | %18.1f %5.0f %4.0f %4.0f | %12.0f %4.0f %4.0f\n", row.boardSize, row.boardSize,
+               row.difficulty == EASY ? "easy" : "smart", row.shots.getCount(), row.shots.getMean(),
+               row.shots.quantile(0.5), row.shots.quantile(0.9), row.shots.quantile(0.99),
+               row.volleys.quantile(0.5), row.volleys.quantile(0.9), row.volleys.quantile(0.99));
+    }
+    printf("Time:           %.3f s (%d games)\n", seconds, games * (int)rows.size());
+
+    if (argc > 3 && !writeShotReport(argv[3], rows)) {
+        printf("Cannot write %s\n", argv[3]);
+        return 1;
+    }
+    if (argc > 4 && !writeShotHistogram(argv[4], rows)) {
+        printf("Cannot write %s\n", argv[4]);
+        return 1;
+    }
+    return 0;
+}
+
+// Command line entry: --build-prior <prior file> <board size> <replay log>...
+int runBuildPriorCommand(int argc, char** argv) {
+    int boardSize = (argc > 3) ? atoi(argv[3]) : 0;
+    if (argc < 5 || boardSize < 1) {
+        printf("Usage: %s --build-prior <prior file> <board size> <replay log>...\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<std::string> logs(argv + 4, argv + argc);
+    int games = 0;
+    std::string error;
+    if (!buildTargetPrior(logs, boardSize, argv[2], games, error)) {
+        printf("Prior error: %s\n", error.c_str());
+        return 1;
+    }
+    printf("Prior:          %s (%dx%d board, %d games from %zu logs)\n",
+           argv[2], boardSize, boardSize, games, logs.size());
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: simulation.hpp
+ * Description: Header file for the headless batch simulator. Plays AI vs AI games
+ *              without the UI, with all per-game memory owned by a SessionArena that
+ *              is reset between games.
+ */
+
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include "../logic/ai_logic.hpp"
+#include "../data/fleet_config.hpp"
+#include "../data/session_arena.hpp"
+#include "../data/volley_summary.hpp"
+#include "../logic/rating_ladder.hpp"
+#include "../logic/quantile_sketch.hpp"
+#include <string>
+#include <vector>
+
+// Outcome of one simulated game
+struct SimulationResult {
+    int winner;         // 0 = first AI, 1 = second AI
+    int turns;          // Volleys fired by both sides
+    int shotsFirst;     // Shots fired by first AI
+    int shotsSecond;    // Shots fired by second AI
+};
+
+// Aggregate over a batch of simulated games
+struct SimulationSummary {
+    int games;
+    int winsFirst;
+    int winsSecond;
+    long long totalTurns;
+    long long totalShots;
+    long long winnerShots;      // Shots the winner needed, summed over games
+    size_t arenaBytesPeak;      // Largest per-game arena footprint
+    size_t arenaCapacity;       // Arena memory reserved at the end of the batch
+
+    SimulationSummary() : games(0), winsFirst(0), winsSecond(0), totalTurns(0),
+                          totalShots(0), winnerShots(0), arenaBytesPeak(0), arenaCapacity(0) {}
+};
+
+// Play one AI vs AI game; the first AI fires first
+// arena: owner of boards and targeting state (nullptr = heap)
+// seed: both AIs' engines are seeded from it, so a seed replays the same game
+SimulationResult simulateGame(AIDifficulty first, AIDifficulty second,
+                              const FleetConfig& fleet, SessionArena* arena, unsigned long long seed);
+
+// As above, each side firing its own number of shots per volley
+SimulationResult simulateGame(AIDifficulty first, int firstShots, AIDifficulty second, int secondShots,
+                              const FleetConfig& fleet, SessionArena* arena, unsigned long long seed);
+
+// Play `games` games reusing a single arena, resetting it between games
+SimulationSummary runSimulation(AIDifficulty first, AIDifficulty second,
+                                const FleetConfig& fleet, int games);
+
+// Games merged into the ladder per rating period by runLadderCommand
+const int LADDER_GAMES_PER_PERIOD = 2000;
+
+// One rated AI configuration of the ladder
+struct LadderConfig {
+    AIDifficulty difficulty;
+    int boardSize;
+    int shotsPerTurn;
+};
+
+// Ladder name of a configuration, e.g. "smart 10x10 3/turn"
+std::string ladderConfigName(const LadderConfig& config);
+
+// Play `games` rated games between configurations of the same board size on `threads`
+// worker threads, each filling its own RatingShard; the shards are merged and the ladder
+// rated every gamesPerPeriod games. Players of ladder are configs, in order.
+void runLadder(RatingLadder& ladder, const std::vector<LadderConfig>& configs,
+               long long games, int threads, int gamesPerPeriod);
+
+// Shots and volleys the winner needed in self-play, for one board size and difficulty
+struct ShotReportRow {
+    int boardSize;
+    AIDifficulty difficulty;
+    QuantileSketch shots;
+    QuantileSketch volleys;
+};
+
+// Play `games` self-play games per board size and difficulty, one row each
+// seed: every game's seed is drawn from it, so a seed reproduces the report
+void runShotReport(const std::vector<int>& sizes, int games, std::vector<ShotReportRow>& rows,
+                   unsigned long long seed);
+
+// CSV with one line per row and metric: count, mean, min, p10-p99 and max
+bool writeShotReport(const std::string& path, const std::vector<ShotReportRow>& rows);
+
+// CSV of the sketch buckets: per row and metric, each bucket's range and count
+bool writeShotHistogram(const std::string& path, const std::vector<ShotReportRow>& rows);
+
+// "easy" or "smart" (case-sensitive); anything else is SMART
+AIDifficulty parseDifficulty(const char* name);
+
+// Command line entry: --simulate <games> [easy|smart] [easy|smart] [fleet file]
+// Prints a summary to stdout; returns the process exit code
+int runSimulationCommand(int argc, char** argv);
+
+// Command line entry: --ladder <games> [threads] [board size]...
+// Rates easy/smart at 1, 3 and 5 shots per turn on each board size (default 10)
+int runLadderCommand(int argc, char** argv);
+
+// Command line entry: --shot-report <games> [percentiles csv] [histogram csv]
+// Covers every board size of getShipConfig (10-26) with both difficulties
+int runShotReportCommand(int argc, char** argv);
+
+// Command line entry: --build-prior <prior file> <board size> <replay log>...
+// Adds or replaces that board size's section of the prior; returns the process exit code
+int runBuildPriorCommand(int argc, char** argv);
+
+#endif
@@ -0,0 +1,159 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: spectator_view.cpp
+ * Description: Implementation of the spectator view. Reads the host's event stream
+ *              (replay log lines), feeds it to a BoardEventRenderer and shows the turn
+ *              and the winner. Ships are never revealed; only shots and sunk ships are.
+ */
+
+#include "spectator_view.hpp"
+#include "multiplayer_game_loop.hpp"
+#include "../ui/ui_renderer.hpp"
+#include "../ui/board_screen.hpp"
+#include "../ui/board_event_renderer.hpp"
+#include "../logic/spectator_hub.hpp"
+#include "../logic/replay_log.hpp"
+#include <cstdio>
+#include <string>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #define SLEEP_MS(x) Sleep(x)
+#else
+    #include <unistd.h>
+    #include <sys/select.h>
+    #define SLEEP_MS(x) usleep((x) * 1000)
+#endif
+
+// Wait up to timeoutMs for data on the socket
+static bool socketReadable(SOCKET_TYPE socket, int timeoutMs) {
+    fd_set readSet;
+    FD_ZERO(&readSet);
+    FD_SET(socket, &readSet);
+    struct timeval tv;
+    tv.tv_sec = 0;
+    tv.tv_usec = timeoutMs * 1000;
+    return select((int)socket + 1, &readSet, nullptr, nullptr, &tv) > 0;
+}
+
+// Move the first complete line out of pending; returns false if there is none
+static bool takeLine(std::string& pending, std::string& line) {
+    size_t end = pending.find('\n');
+    if (end == std::string::npos) return false;
+    line.assign(pending, 0, end);
+    pending.erase(0, end + 1);
+    return true;
+}
+
+// Show an error and wait for a key
+static void showSpectateError(const char* message) {
+    clear();
+    mvprintw(5, 2, "%s", message);
+    mvprintw(6, 2, "Press any key to exit...");
+    refresh();
+    nodelay(stdscr, FALSE);
+    getch();
+    clear();
+}
+
+// Status line above the boards
+static void drawSpectatorStatus(const char* hostname, int turn, int winner) {
+    move(1, 2);
+    clrtoeol();
+    attron(COLOR_PAIR(6) | A_BOLD);
+    if (winner < 0) {
+        printw("Spectating %s | Turn %d | q - quit", hostname, turn + 1);
+    } else {
+        printw("Spectating %s | %s wins! | q - quit", hostname, winner == PLAYER_SIDE ? "Host" : "Client");
+    }
+    attroff(COLOR_PAIR(6) | A_BOLD);
+    attron(COLOR_PAIR(1));
+}
+
+// Watch a hosted match
+void watchMultiplayerGame(const char* hostname) {
+    clear();
+    refresh();
+
+    SOCKET_TYPE sock = connectToHost(hostname, SPECTATOR_PORT);
+    if (sock == INVALID_SOCKET_VALUE) {
+        showSpectateError("Connection failed. Is a match being hosted?");
+        return;
+    }
+
+    // Stream header: "B <boardSize> <shotsPerTurn>"
+    std::string pending, line;
+    char buffer[4096];
+    while (!takeLine(pending, line)) {
+        int received = recv(sock, buffer, sizeof(buffer), 0);
+        if (received <= 0) {
+            closesocket(sock);
+            showSpectateError("Error: Connection lost!");
+            return;
+        }
+        pending.append(buffer, received);
+    }
+    int size = 0, shots = 0;
+    if (!parseReplayHeader(line.c_str(), size, shots) || size < MIN_BOARD_SIZE || size > MAX_BOARD_SIZE) {
+        closesocket(sock);
+        showSpectateError("Error: Not a SeaBattle spectator stream");
+        return;
+    }
+
+    // Host's board on the left, client's board on the right
+    BoardScreen screen(size, "Host", "Client");
+    BoardEventRenderer renderer(screen);
+    clear();
+    screen.draw();
+
+    bool connected = true;
+    int turn = 0, winner = -1;
+    drawSpectatorStatus(hostname, turn, winner);
+    refresh();
+
+    while (true) {
+        nodelay(stdscr, TRUE);
+        int key = getch();
+        nodelay(stdscr, FALSE);
+        if (key == 'q' || key == 'Q') break;
+        if (key == KEY_RESIZE) {
+            screen.relayout();
+            clear();
+            screen.draw();
+            renderer.redrawVolleys();
+            drawSpectatorStatus(hostname, turn, winner);
+        }
+
+        if (!connected) {
+            SLEEP_MS(50);
+            continue;
+        }
+        if (!socketReadable(sock, 50)) continue;
+
+        int received = recv(sock, buffer, sizeof(buffer), 0);
+        if (received <= 0) {
+            connected = false;
+            mvprintw(2, 2, "Host closed the stream");
+            refresh();
+            continue;
+        }
+        pending.append(buffer, received);
+
+        // Apply every complete event line
+        GameEvent event;
+        while (takeLine(pending, line)) {
+            if (!parseReplayLine(line.c_str(), event)) continue;
+            renderer.onEvent(event);
+            turn = event.turn;
+            if (event.type == EVENT_GAME_OVER) winner = event.value;
+        }
+        drawSpectatorStatus(hostname, turn, winner);
+        refresh();
+    }
+
+    closesocket(sock);
+    clear();
+}
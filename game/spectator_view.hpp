@@ -0,0 +1,18 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: spectator_view.hpp
+ * Description: Header file for the read-only spectator view of a hosted match.
+ */
+
+#ifndef SPECTATOR_VIEW_HPP
+#define SPECTATOR_VIEW_HPP
+
+// Connect to a host's spectator channel and draw the match as it is played
+// hostname: host running playMultiplayerHost
+// Returns when the user presses q
+void watchMultiplayerGame(const char* hostname);
+
+#endif
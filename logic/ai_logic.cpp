@@ -11,29 +11,71 @@
 
 #include "ai_logic.hpp"
 #include "game_logic.hpp"
+#include "placement_density.hpp"
+#include "shot_history.hpp"
+#include "target_prior.hpp"
+#include "../data/trace.hpp"
 #include <algorithm>
-#include <ctime>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
 
+// Clock tick mixed with a process-wide counter, so two AIs never share a seed
+unsigned long long makeAISeed() {
+    static std::atomic<unsigned long long> counter(0);
+    unsigned long long tick = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    return tick ^ (counter.fetch_add(1, std::memory_order_relaxed) * 0x9e3779b97f4a7c15ull);
+}
+
 // Constructor - initializes AI with difficulty level and board size
 // diff: AI difficulty (EASY or SMART)
 // size: board dimensions (NxN)
 AILogic::AILogic(AIDifficulty diff, int size) 
+    : AILogic(diff, getFleetConfig(size)) {
+}
+
+// Constructor - initializes AI with a custom fleet definition
+// diff: AI difficulty (EASY or SMART)
+// fleetConfig: ship lengths/counts and board size
+AILogic::AILogic(AIDifficulty diff, const FleetConfig& fleetConfig) 
+    : AILogic(diff, fleetConfig, nullptr) {
+}
+
+// Constructor - custom fleet with per-game state in a session arena
+// diff: AI difficulty (EASY or SMART)
+// fleetConfig: ship lengths/counts and board size
+// arena: session arena owning boards and targeting lists (nullptr = heap)
+AILogic::AILogic(AIDifficulty diff, const FleetConfig& fleetConfig, SessionArena* arena) 
+    : AILogic(diff, fleetConfig, arena, makeAISeed()) {
+}
+
+// Constructor - custom fleet, session arena and seed
+// seed: seeds this AI's random source, used for its shot order and fleet placement
+AILogic::AILogic(AIDifficulty diff, const FleetConfig& fleetConfig, SessionArena* arena, unsigned long long seed) 
     : difficulty(diff), 
-      aiBoard(size),
+      aiBoard(fleetConfig.boardSize, arena),
+      opponentBoard(arena),
       hunting(false), 
-      huntDirection(0),
-      boardSize(size) {
+      huntDirection(HUNT_NONE),
+      availableShots(arena),
+      targetQueue(arena),
+      parityShots(arena),
+      rng(seed),
+      boardSize(fleetConfig.boardSize),
+      fleet(fleetConfig),
+      prior(nullptr),
+      densityValid(false),
+      endgameValid(false),
+      endgameActive(false) {
+    endgame.layouts = -1;
     
     // Initialize opponent board tracking (AI's view of player board)
-    opponentBoard.resize(size, std::vector<char>(size, '?'));
+    opponentBoard.resize(boardSize, ArenaVector<char>(boardSize, '?', arena));
     
     // Initialize attack coordinates tracking
     lastHit.x = -1;
     lastHit.y = -1;
-    
-    // Seed random number generator
-    attackSeed = time(NULL) + 12345;
+    pendingSunk = lastHit;
     
     // Initialize targeting queues
     targetQueue.clear();
@@ -41,11 +83,39 @@ AILogic::AILogic(AIDifficulty diff, int size)
     
     // Generate all available shot coordinates
     initializeAvailableShots();
+    initializeShipsLeft();
     
     // Generate AI's board with random ship placement
     setupBoard();
 }
 
+// Copy the targeting state of another AI; the ship board is left empty
+AILogic::AILogic(const AILogic& source, SessionArena* arena)
+    : difficulty(source.difficulty),
+      aiBoard(source.boardSize, arena),
+      opponentBoard(arena),
+      lastHit(source.lastHit),
+      hunting(source.hunting),
+      huntDirection(source.huntDirection),
+      availableShots(source.availableShots.begin(), source.availableShots.end(), arena),
+      targetQueue(source.targetQueue.begin(), source.targetQueue.end(), arena),
+      parityShots(source.parityShots.begin(), source.parityShots.end(), arena),
+      rng(source.rng),
+      boardSize(source.boardSize),
+      fleet(source.fleet),
+      shipsLeft(source.shipsLeft),
+      pendingSunk(source.pendingSunk),
+      density(source.density),
+      prior(source.prior),
+      densityValid(source.densityValid),
+      endgame(source.endgame),
+      endgameValid(source.endgameValid),
+      endgameActive(source.endgameActive) {
+    for (const auto& row : source.opponentBoard) {
+        opponentBoard.push_back(ArenaVector<char>(row.begin(), row.end(), arena));
+    }
+}
+
 // Generate AI's board with random ship placement
 void AILogic::setupBoard() {
     aiBoard.setIsHost(false);
@@ -53,8 +123,54 @@ void AILogic::setupBoard() {
     
     // Initialize and place ships randomly
     std::vector<GamePiece> pieces;
-    GameLogic::initializeGamePieces(aiBoard, pieces);
-    GameLogic::generateBoardPlacement(aiBoard, pieces);
+    GameLogic::initializeGamePieces(aiBoard, pieces, fleet);
+    GameLogic::generateBoardPlacement(aiBoard, pieces, rng);
+    aiBoard.buildShipCellMap();
+}
+
+// Place the fleet ship by ship, each at the coldest of several random legal spots
+void AILogic::setupBoard(const ShotHistory& history) {
+    if (history.getGames() == 0 || history.getBoardSize() != boardSize) {
+        setupBoard();
+        return;
+    }
+    
+    aiBoard.setIsHost(false);
+    aiBoard.initialize(boardSize);
+    std::vector<GamePiece> pieces;
+    GameLogic::initializeGamePieces(aiBoard, pieces, fleet);
+    
+    const std::vector<unsigned short>& heat = history.getHeat();
+    int cells = boardSize * boardSize;
+    for (const GamePiece& piece : pieces) {
+        int length = piece.Get_Piece_Length();
+        int bestPeg = -1, bestOrientation = 0;
+        long bestHeat = 0;
+        int found = 0;
+        for (int attempt = 0; attempt < 1000 && found < AI_PLACEMENT_CANDIDATES; attempt++) {
+            int peg = randomBelow(cells);
+            int orientation = randomBelow(2) + 1;  // 1 = vertical (down), 2 = horizontal (left)
+            if (GameLogic::checkStartingPeg(aiBoard, orientation, peg, length) != 1) continue;
+            found++;
+            
+            long shipHeat = 0;
+            for (int j = 0; j < length; j++) {
+                shipHeat += (orientation == 1) ? heat[peg + j * boardSize] : heat[peg - j];
+            }
+            if (bestPeg < 0 || shipHeat < bestHeat) {
+                bestPeg = peg;
+                bestOrientation = orientation;
+                bestHeat = shipHeat;
+            }
+        }
+        
+        // Board too crowded to sample: fall back to the unbiased generator
+        if (bestPeg < 0) {
+            setupBoard();
+            return;
+        }
+        aiBoard.addShip(bestOrientation, bestPeg, length, piece.Get_Piece_Symbol());
+    }
     aiBoard.buildShipCellMap();
 }
 
@@ -81,9 +197,18 @@ void AILogic::initializeAvailableShots() {
     }
 
     // Randomize shot order for unpredictability
-    std::srand(std::time(0));
-    std::random_shuffle(availableShots.begin(), availableShots.end());
-    std::random_shuffle(parityShots.begin(), parityShots.end());
+    std::shuffle(availableShots.begin(), availableShots.end(), rng);
+    std::shuffle(parityShots.begin(), parityShots.end(), rng);
+}
+
+// Every ship of the fleet is afloat
+void AILogic::initializeShipsLeft() {
+    shipsLeft.assign(fleet.getLongestShip() + 1, 0);
+    for (const FleetEntry& entry : fleet.ships) {
+        shipsLeft[entry.length] += entry.count;
+    }
+    densityValid = false;
+    endgameValid = false;
 }
 
 // Add all valid neighboring cells to target queue (for smart AI)
@@ -110,9 +235,201 @@ void AILogic::addSmartNeighbors(int x, int y) {
     }
 }
 
+// Mark the sunk ship through (x, y) and remove it from shipsLeft
+// Only the sinking shot is reported, so the ship is taken to be the longer run of hits
+// through it (ships may touch, so a neighbouring wounded ship can be swept in)
+void AILogic::markSunkShip(int x, int y) {
+    int left = x, right = x, top = y, bottom = y;
+    while (left > 0 && opponentBoard[y][left - 1] == 'X') left--;
+    while (right < boardSize - 1 && opponentBoard[y][right + 1] == 'X') right++;
+    while (top > 0 && opponentBoard[top - 1][x] == 'X') top--;
+    while (bottom < boardSize - 1 && opponentBoard[bottom + 1][x] == 'X') bottom++;
+    
+    int length;
+    if (right - left >= bottom - top) {
+        length = right - left + 1;
+        for (int i = left; i <= right; i++) opponentBoard[y][i] = 'S';
+    } else {
+        length = bottom - top + 1;
+        for (int i = top; i <= bottom; i++) opponentBoard[i][x] = 'S';
+    }
+    
+    // Fall back to the longest shorter class if no ship of that length is left
+    if (length >= (int)shipsLeft.size()) length = (int)shipsLeft.size() - 1;
+    while (length > 0 && shipsLeft[length] == 0) length--;
+    if (length > 0) shipsLeft[length]--;
+    densityValid = false;
+    endgameValid = false;
+    requeueOpenHits();
+}
+
+// Fall back to guessing the last sunk ship's cells
+void AILogic::settleSunkShip() {
+    if (pendingSunk.x < 0) return;
+    markSunkShip(pendingSunk.x, pendingSunk.y);
+    pendingSunk.x = -1;
+    pendingSunk.y = -1;
+}
+
+// Neighbours of a sunk ship are no better than any other cell; hits on a ship that
+// touched it (and whose side targets a locked line may have pruned) are hunted again
+void AILogic::requeueOpenHits() {
+    if (difficulty != SMART) return;
+    
+    targetQueue.clear();
+    for (int y = 0; y < boardSize; y++) {
+        for (int x = 0; x < boardSize; x++) {
+            if (opponentBoard[y][x] != 'X') continue;
+            addSmartNeighbors(x, y);
+            lastHit.x = x;
+            lastHit.y = y;
+            hunting = true;
+        }
+    }
+}
+
+// Two hits side by side fix the ship's axis; the cells beside the line cannot hold it
+void AILogic::lockHuntAxis(int x, int y) {
+    bool horizontal = (x > 0 && opponentBoard[y][x - 1] == 'X') ||
+                      (x < boardSize - 1 && opponentBoard[y][x + 1] == 'X');
+    bool vertical = (y > 0 && opponentBoard[y - 1][x] == 'X') ||
+                    (y < boardSize - 1 && opponentBoard[y + 1][x] == 'X');
+    if (horizontal == vertical) return;  // A lone hit, or a corner where two ships touch
+    
+    huntDirection = horizontal ? HUNT_HORIZONTAL : HUNT_VERTICAL;
+    int dx = horizontal ? 1 : 0, dy = horizontal ? 0 : 1;
+    
+    // Extent of the line of hits through (x, y)
+    int first = 0, last = 0;
+    while (isValidCoordinate(x + (first - 1) * dx, y + (first - 1) * dy) &&
+           opponentBoard[y + (first - 1) * dy][x + (first - 1) * dx] == 'X') first--;
+    while (isValidCoordinate(x + (last + 1) * dx, y + (last + 1) * dy) &&
+           opponentBoard[y + (last + 1) * dy][x + (last + 1) * dx] == 'X') last++;
+    
+    // Offset along the line and distance across it of a queued cell
+    auto besideLine = [&](const AICoordinates& c) {
+        int along = horizontal ? c.x - x : c.y - y;
+        int across = horizontal ? c.y - y : c.x - x;
+        return along >= first && along <= last && (across == 1 || across == -1);
+    };
+    targetQueue.erase(std::remove_if(targetQueue.begin(), targetQueue.end(), besideLine), targetQueue.end());
+}
+
+// Follow the locked line: past the end lastHit is on first, then past the other end
+bool AILogic::nextInLine(AICoordinates& next) {
+    int dx = (huntDirection == HUNT_HORIZONTAL) ? 1 : 0;
+    int dy = (huntDirection == HUNT_VERTICAL) ? 1 : 0;
+    int x = lastHit.x, y = lastHit.y;
+    
+    int first = 0, last = 0;
+    while (isValidCoordinate(x + (first - 1) * dx, y + (first - 1) * dy) &&
+           opponentBoard[y + (first - 1) * dy][x + (first - 1) * dx] == 'X') first--;
+    while (isValidCoordinate(x + (last + 1) * dx, y + (last + 1) * dy) &&
+           opponentBoard[y + (last + 1) * dy][x + (last + 1) * dx] == 'X') last++;
+    
+    int ends[2] = { last + 1, first - 1 };
+    if (last != 0) std::swap(ends[0], ends[1]);  // lastHit is not the forward end
+    for (int end : ends) {
+        int cx = x + end * dx, cy = y + end * dy;
+        if (isValidCoordinate(cx, cy) && findAvailable(cx, cy) >= 0) {
+            next.x = cx;
+            next.y = cy;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Position of a cell in availableShots
+int AILogic::findAvailable(int x, int y) const {
+    for (size_t i = 0; i < availableShots.size(); i++) {
+        if (availableShots[i].x == x && availableShots[i].y == y) return (int)i;
+    }
+    return -1;
+}
+
+// Recompute the placement density from misses and sunk ships
+bool AILogic::updateDensity() {
+    settleSunkShip();
+    if (boardSize > DENSITY_MAX_BOARD) return false;
+    if (densityValid) return true;
+    
+    unsigned int blocked[DENSITY_MAX_BOARD] = {0};
+    for (int y = 0; y < boardSize; y++) {
+        for (int x = 0; x < boardSize; x++) {
+            char cell = opponentBoard[y][x];
+            if (cell == 'O' || cell == 'S') blocked[y] |= 1u << x;
+        }
+    }
+    densityValid = computePlacementDensity(blocked, boardSize, shipsLeft, density);
+    return densityValid;
+}
+
+// Highest-density cell of shots, scanning from the back so ties keep the shuffled order
+size_t AILogic::densestShot(const ArenaVector<AICoordinates>& shots) {
+    size_t best = shots.size() - 1;
+    long long bestCount = -1;
+    for (size_t i = shots.size(); i-- > 0; ) {
+        long long count = density[shots[i].y * boardSize + shots[i].x];
+        if (prior) count *= prior->weight(shots[i].x, shots[i].y);
+        if (count > bestCount) {
+            best = i;
+            bestCount = count;
+        }
+    }
+    return best;
+}
+
+// Enumerate the remaining fleet exactly once few enough layouts are left
+bool AILogic::updateEndgame() {
+    settleSunkShip();
+    if (difficulty != SMART || boardSize > ENDGAME_MAX_BOARD) return false;
+    if (endgameValid) return endgameActive;
+    
+    // No layout fitted the shots (sunk ships that touched were told apart wrongly);
+    // more shots cannot make one fit, so stay with density targeting
+    if (endgame.layouts == 0) {
+        endgameValid = true;
+        endgameActive = false;
+        return false;
+    }
+    
+    unsigned int blocked[ENDGAME_MAX_BOARD] = {0};
+    unsigned int hits[ENDGAME_MAX_BOARD] = {0};
+    for (int y = 0; y < boardSize; y++) {
+        for (int x = 0; x < boardSize; x++) {
+            char cell = opponentBoard[y][x];
+            if (cell == 'O' || cell == 'S') blocked[y] |= 1u << x;
+            if (cell == 'X') hits[y] |= 1u << x;
+        }
+    }
+    endgameActive = solveEndgame(blocked, hits, boardSize, shipsLeft, ENDGAME_MAX_LAYOUTS, endgame);
+    endgameValid = true;
+    return endgameActive;
+}
+
+// Remove a shot from the available and parity lists
+AICoordinates AILogic::takeShot(size_t index) {
+    AICoordinates coord = availableShots[index];
+    availableShots.erase(availableShots.begin() + index);
+    for (size_t i = 0; i < parityShots.size(); i++) {
+        if (parityShots[i].x == coord.x && parityShots[i].y == coord.y) {
+            parityShots.erase(parityShots.begin() + i);
+            break;
+        }
+    }
+    return coord;
+}
+
+// Uniform draw from this AI's own engine
+int AILogic::randomBelow(int n) {
+    return std::uniform_int_distribution<int>(0, n - 1)(rng);
+}
+
 // Select next attack coordinates based on AI difficulty
 // Returns: coordinates to attack, or (-1, -1) if no valid shots remain
 AICoordinates AILogic::pickAttackCoordinates() {
+    TRACE_SCOPE("AILogic::pickAttackCoordinates");
     AICoordinates coord;
     coord.x = -1; 
     coord.y = -1;
@@ -122,7 +439,7 @@ AICoordinates AILogic::pickAttackCoordinates() {
 
     // EASY MODE: completely random targeting
     if (difficulty == EASY) {
-        int index = rand() % availableShots.size();
+        int index = randomBelow((int)availableShots.size());
         coord = availableShots[index];
         availableShots.erase(availableShots.begin() + index);
         return coord;
@@ -130,41 +447,53 @@ AICoordinates AILogic::pickAttackCoordinates() {
 
     // SMART MODE: prioritized targeting strategy
     
-    // Priority 1: Target queued cells (neighbors of previous hits)
-    while (!targetQueue.empty()) {
-        coord = targetQueue.front();
-        targetQueue.pop_front();
-        
-        // Verify coordinate is still available
-        bool valid = false;
-        int removeIndex = -1;
-        
-        for (size_t i = 0; i < availableShots.size(); i++) {
-            if (availableShots[i].x == coord.x && availableShots[i].y == coord.y) {
-                valid = true;
-                removeIndex = i;
-                break;
+    // Endgame: with every remaining layout known, fire at the cell most of them share
+    // (highest hit chance, so the fewest expected shots to finish; ties keep the shuffled order)
+    if (updateEndgame()) {
+        size_t best = availableShots.size() - 1;
+        unsigned int bestCover = 0;
+        for (size_t i = availableShots.size(); i-- > 0; ) {
+            unsigned int cover = endgame.cover[availableShots[i].y * boardSize + availableShots[i].x];
+            if (cover > bestCover) {
+                best = i;
+                bestCover = cover;
             }
         }
+        return takeShot(best);
+    }
+    
+    // Priority 1: Extend a line of two or more hits along its axis
+    if (hunting && huntDirection != HUNT_NONE && lastHit.x >= 0) {
+        if (nextInLine(coord)) return takeShot(findAvailable(coord.x, coord.y));
         
-        if (valid) {
-            // Remove from both available lists
-            availableShots.erase(availableShots.begin() + removeIndex);
-            for(size_t i=0; i<parityShots.size(); ++i) {
-                if(parityShots[i].x == coord.x && parityShots[i].y == coord.y) {
-                    parityShots.erase(parityShots.begin() + i);
-                    break;
-                }
+        // Both ends are closed but the ship still floats: the line was ships lying
+        // side by side, so their other neighbours are targets again
+        huntDirection = HUNT_NONE;
+        for (int y = 0; y < boardSize; y++) {
+            for (int x = 0; x < boardSize; x++) {
+                if (opponentBoard[y][x] == 'X') addSmartNeighbors(x, y);
             }
-            return coord;
         }
     }
+    
+    // Priority 2: Target queued cells (neighbors of previous hits)
+    while (!targetQueue.empty()) {
+        coord = targetQueue.front();
+        targetQueue.pop_front();
+        
+        // Verify coordinate is still available (and its result not already recorded)
+        int index = findAvailable(coord.x, coord.y);
+        if (index >= 0 && opponentBoard[coord.y][coord.x] == '?') return takeShot(index);
+    }
 
-    // Priority 2: Use parity targeting (checkerboard pattern)
-    // This finds ships more efficiently than pure random
+    // Priority 3: Use parity targeting (checkerboard pattern)
+    // This finds ships more efficiently than pure random; among parity cells,
+    // take the one the most remaining ship placements cover
     if (!parityShots.empty()) {
-        coord = parityShots.back();
-        parityShots.pop_back();
+        size_t pick = parityShots.size() - 1;
+        if (updateDensity()) pick = densestShot(parityShots);
+        coord = parityShots[pick];
+        parityShots.erase(parityShots.begin() + pick);
         
         // Remove from available shots list
         for (size_t i = 0; i < availableShots.size(); i++) {
@@ -176,8 +505,8 @@ AICoordinates AILogic::pickAttackCoordinates() {
         return coord;
     }
 
-    // Priority 3: Random shot from remaining available coordinates
-    int index = rand() % availableShots.size();
+    // Priority 4: Densest remaining cell (random when the board is too large for the kernel)
+    size_t index = updateDensity() ? densestShot(availableShots) : randomBelow((int)availableShots.size());
     coord = availableShots[index];
     availableShots.erase(availableShots.begin() + index);
     return coord;
@@ -191,25 +520,35 @@ void AILogic::recordShotResult(int x, int y, bool isHit, bool isSunk) {
     // Validate coordinates
     if (x >= 0 && x < boardSize && y >= 0 && y < boardSize) {
         // Update opponent board tracking
+        settleSunkShip();
         opponentBoard[y][x] = isHit ? 'X' : 'O';
+        densityValid = false;
+        endgameValid = false;
+        if (isSunk) {
+            pendingSunk.x = x;
+            pendingSunk.y = y;
+        }
         
         // Smart AI adjusts strategy based on results
         if (difficulty == SMART) {
             if (isHit && !isSunk) {
-                // Hit but not sunk - add neighbors to target queue
+                // Hit but not sunk - add neighbors to target queue, and follow
+                // the line once a second hit shows the ship's axis
                 addSmartNeighbors(x, y);
+                lockHuntAxis(x, y);
             }
             
             if (isSunk) {
-                // Ship sunk - exit hunt mode
+                // Ship sunk - exit hunt mode (requeueOpenHits resumes it for touching ships)
                 hunting = false;
+                huntDirection = HUNT_NONE;
                 lastHit.x = -1;
                 lastHit.y = -1;
             }
         }
 
         // Track last hit for potential follow-up
-        if (isHit) {
+        if (isHit && !isSunk) {
             lastHit.x = x;
             lastHit.y = y;
             hunting = true;
@@ -217,6 +556,20 @@ void AILogic::recordShotResult(int x, int y, bool isHit, bool isSunk) {
     }
 }
 
+// Mark the revealed cells of the ship just sunk
+void AILogic::recordSunkShip(const std::vector<std::pair<int, int>>& cells) {
+    pendingSunk.x = -1;
+    pendingSunk.y = -1;
+    for (const auto& cell : cells) {
+        if (isValidCoordinate(cell.first, cell.second)) opponentBoard[cell.second][cell.first] = 'S';
+    }
+    int length = (int)cells.size();
+    if (length > 0 && length < (int)shipsLeft.size() && shipsLeft[length] > 0) shipsLeft[length]--;
+    densityValid = false;
+    endgameValid = false;
+    requeueOpenHits();
+}
+
 // Check if coordinates are within board bounds
 // Returns: true if valid, false otherwise
 bool AILogic::isValidCoordinate(int x, int y) {
@@ -231,16 +584,87 @@ void AILogic::clearTargetQueue() {
 // Reset AI state for a new game
 void AILogic::reset() {
     // Reset opponent board tracking
-    opponentBoard.assign(boardSize, std::vector<char>(boardSize, '?'));
+    opponentBoard.assign(boardSize, ArenaVector<char>(boardSize, '?', opponentBoard.get_allocator()));
     
     // Reset hunt mode tracking
     lastHit.x = -1;
     lastHit.y = -1;
     
     hunting = false;
-    huntDirection = 0;
+    huntDirection = HUNT_NONE;
+    pendingSunk = lastHit;
     
     // Clear targeting data
     clearTargetQueue();
     initializeAvailableShots();
-}
\ No newline at end of file
+    initializeShipsLeft();
+    endgame.layouts = -1;
+}
+
+// Only a prior for this board size is used
+void AILogic::setTargetPrior(const TargetPrior* targetPrior) {
+    prior = (targetPrior && targetPrior->isLoaded() && targetPrior->getBoardSize() == boardSize)
+            ? targetPrior : nullptr;
+}
+
+// Density of the remaining fleet over the AI's view of the opponent's board
+const std::vector<unsigned short>& AILogic::getDensityGrid() {
+    updateDensity();
+    return density;
+}
+
+// Heap copy of the targeting state
+std::shared_ptr<AILogic> AILogic::snapshot() const {
+    return std::shared_ptr<AILogic>(new AILogic(*this, nullptr));
+}
+
+// Play one volley against a board copy, stopping when the fleet is gone
+AIVolleyPlan AILogic::planVolley(BoardData& target, int shots) {
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+    
+    AIVolleyPlan plan;
+    for (int i = 0; i < shots && target.getRemainingShips() > 0; i++) {
+        AICoordinates shot = pickAttackCoordinates();
+        if (shot.x == -1 || shot.y == -1) break;
+
+        int result = target.receiveShot(shot.x, shot.y);
+        recordShotResult(shot.x, shot.y, result != 0, result == 2);
+        if (result == 2) recordSunkShip(target.getShipOccupiedCells(shot.x, shot.y));
+        plan.shots.push_back(shot);
+        plan.results.push_back(result);
+    }
+    plan.planMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    return plan;
+}
+
+// Copy the planner's targeting state back (keeping this AI's allocator and ships)
+void AILogic::adoptTargeting(const AILogic& planner) {
+    for (int y = 0; y < boardSize; y++) {
+        opponentBoard[y].assign(planner.opponentBoard[y].begin(), planner.opponentBoard[y].end());
+    }
+    lastHit = planner.lastHit;
+    hunting = planner.hunting;
+    huntDirection = planner.huntDirection;
+    availableShots.assign(planner.availableShots.begin(), planner.availableShots.end());
+    targetQueue.assign(planner.targetQueue.begin(), planner.targetQueue.end());
+    parityShots.assign(planner.parityShots.begin(), planner.parityShots.end());
+    rng = planner.rng;
+    shipsLeft = planner.shipsLeft;
+    pendingSunk = planner.pendingSunk;
+    densityValid = false;
+    endgame = planner.endgame;
+    endgameValid = planner.endgameValid;
+    endgameActive = planner.endgameActive;
+}
+
+// Snapshot now, plan on another thread
+std::future<AIVolleyPlan> AILogic::prefetchVolley(const BoardData& target, int shots) const {
+    std::shared_ptr<AILogic> planner = snapshot();
+    std::shared_ptr<BoardData> board(new BoardData(target));
+    return std::async(std::launch::async, [planner, board, shots]() {
+        AIVolleyPlan plan = planner->planVolley(*board, shots);
+        plan.after = planner;
+        return plan;
+    });
+}
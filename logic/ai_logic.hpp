@@ -14,48 +14,149 @@
 
 #include "../data/board_data.hpp"
 #include "../data/game_state.hpp"
+#include "../data/fleet_config.hpp"
+#include "endgame_solver.hpp"
+#include "game_logic.hpp"
 #include <vector>
 #include <deque>
+#include <future>
+#include <memory>
 
 // AI difficulty levels
 enum AIDifficulty { EASY, SMART };
 
+// Axis of a line of hits the Smart AI is following (AILogic::huntDirection)
+enum HuntAxis { HUNT_NONE, HUNT_HORIZONTAL, HUNT_VERTICAL };
+
+// Random legal spots tried per ship by setupBoard(history); the coldest one is used
+const int AI_PLACEMENT_CANDIDATES = 8;
+
+// Seed for a new AI; distinct on every call, also for AIs built on several threads
+// within one clock tick
+unsigned long long makeAISeed();
+
+class AILogic;
+class ShotHistory;
+class TargetPrior;
+
+// A volley worked out ahead of time by AILogic::planVolley
+struct AIVolleyPlan {
+    std::vector<AICoordinates> shots;      // Targets in firing order
+    std::vector<int> results;              // Result each shot will have (0 miss, 1 hit, 2 sunk)
+    std::shared_ptr<AILogic> after;        // Planner state after the volley (see adoptTargeting)
+    double planMs;                         // Time spent choosing the shots
+};
+
 class AILogic {
 private:
     AIDifficulty difficulty;                        // Current AI difficulty level
     BoardData aiBoard;                              // AI's own board with ships
-    std::vector<std::vector<char>> opponentBoard;   // AI's knowledge of player's board
+    ArenaGrid opponentBoard;                        // AI's knowledge of player's board
     
     AICoordinates lastHit;                          // Last successful hit coordinates
     bool hunting;                                    // Whether AI is in hunt mode
-    int huntDirection;                               // Current hunting direction
+    int huntDirection;                               // HuntAxis of the line through lastHit
     
-    std::vector<AICoordinates> availableShots;      // All remaining available shots
-    std::deque<AICoordinates> targetQueue;          // Priority targets (neighbors of hits)
-    std::vector<AICoordinates> parityShots;         // Checkerboard pattern shots
+    ArenaVector<AICoordinates> availableShots;      // All remaining available shots
+    ArenaDeque<AICoordinates> targetQueue;          // Priority targets (neighbors of hits)
+    ArenaVector<AICoordinates> parityShots;         // Checkerboard pattern shots
     
-    unsigned int attackSeed;                         // Random seed for attacks
+    GameRng rng;                                     // This AI's own random source (shot order, placement)
     int boardSize;                                   // Size of game board
+    FleetConfig fleet;                               // Fleet placed on aiBoard
+    
+    std::vector<int> shipsLeft;                      // Opponent ships afloat, indexed by length
+    AICoordinates pendingSunk;                       // Sinking shot whose ship cells are unknown yet
+    std::vector<unsigned short> density;             // Placements covering each cell (row-major)
+    const TargetPrior* prior;                        // Where players tend to put ships (not owned, may be nullptr)
+    bool densityValid;                               // density matches opponentBoard/shipsLeft
+    EndgameResult endgame;                           // Exact layouts of the remaining fleet
+    bool endgameValid;                               // endgame matches opponentBoard/shipsLeft
+    bool endgameActive;                              // Layouts few enough to enumerate
     
     // Initialize all possible shot coordinates
     void initializeAvailableShots();
     
+    // Count the whole fleet as afloat
+    void initializeShipsLeft();
+    
     // Add neighboring cells to target queue after a hit
     void addSmartNeighbors(int x, int y);
     
+    // Mark the sunk ship through (x, y) as 'S' on opponentBoard and drop it from shipsLeft
+    void markSunkShip(int x, int y);
+    
+    // Guess the cells of pendingSunk (markSunkShip) unless recordSunkShip supplied them
+    void settleSunkShip();
+    
+    // After a sinking: drop stale targets and queue the neighbours of hits still afloat
+    void requeueOpenHits();
+    
+    // Lock huntDirection once the hit at (x, y) has a hit neighbour in one axis only,
+    // dropping queued targets beside the line
+    void lockHuntAxis(int x, int y);
+    
+    // Next cell beyond either end of the locked line through lastHit; false if both are closed
+    bool nextInLine(AICoordinates& next);
+    
+    // Index of (x, y) in availableShots, or -1 if it was already fired at
+    int findAvailable(int x, int y) const;
+    
+    // Refresh density if stale; returns false if the board is too large for the kernel
+    bool updateDensity();
+    
+    // Index into shots of the cell with the highest density, weighted by the prior
+    // when one is set (ties keep the later entry)
+    size_t densestShot(const ArenaVector<AICoordinates>& shots);
+    
+    // Re-solve the endgame if stale; returns true if the exact layouts are known
+    bool updateEndgame();
+    
+    // Take shot `index` of availableShots, dropping it from parityShots as well
+    AICoordinates takeShot(size_t index);
+    
+    // Uniform in [0, n) from rng; safe to use off the UI thread
+    int randomBelow(int n);
+    
+    // Copy the targeting state of source (not its ships) into a new AI allocating from arena
+    AILogic(const AILogic& source, SessionArena* arena);
+    
 public:
     // Constructor - initializes AI with difficulty and board size
     AILogic(AIDifficulty diff, int size);
     
+    // Constructor - initializes AI with a custom fleet (board size taken from the fleet)
+    AILogic(AIDifficulty diff, const FleetConfig& fleetConfig);
+    
+    // Constructor - custom fleet with all per-game state allocated from arena (nullptr = heap)
+    AILogic(AIDifficulty diff, const FleetConfig& fleetConfig, SessionArena* arena);
+    
+    // Constructor - as above with an explicit seed; the same seed gives the same fleet
+    // and the same shots for the same results
+    AILogic(AIDifficulty diff, const FleetConfig& fleetConfig, SessionArena* arena, unsigned long long seed);
+    
     // Generate AI's board with random ship placement
     void setupBoard();
     
+    // Random placement biased away from where this opponent shoots: each ship goes on
+    // the least shot-at of AI_PLACEMENT_CANDIDATES random legal spots
+    // (plain setupBoard when the history is empty or for another board size)
+    void setupBoard(const ShotHistory& history);
+    
+    // Weight density targeting by where players tend to put their ships; the prior must
+    // outlive this AI and its snapshots (nullptr, or a prior for another size, = none)
+    void setTargetPrior(const TargetPrior* targetPrior);
+    
     // Select next coordinates to attack based on AI strategy
     AICoordinates pickAttackCoordinates();
     
     // Record result of a shot and update AI strategy
     void recordShotResult(int x, int y, bool isHit, bool isSunk);
     
+    // After a sinking shot, the exact cells of the sunk ship (when the board reveals them);
+    // without this call the ship is guessed from the line of hits through the shot
+    void recordSunkShip(const std::vector<std::pair<int, int>>& cells);
+    
     // Check if coordinates are valid
     bool isValidCoordinate(int x, int y);
     
@@ -65,9 +166,32 @@ public:
     // Reset AI state for new game
     void reset();
     
+    // Placements of the opponent's remaining ships covering each cell, row-major
+    // (empty on boards larger than DENSITY_MAX_BOARD)
+    const std::vector<unsigned short>& getDensityGrid();
+    
+    // Whether the Smart AI is choosing shots from the exact endgame layouts
+    bool inEndgame() { return updateEndgame(); }
+    
+    // Heap copy of the targeting state, safe to hand to another thread
+    std::shared_ptr<AILogic> snapshot() const;
+    
+    // Fire up to `shots` shots at target (a copy of the opponent's board) with this AI's
+    // strategy and record the results, exactly as the turn engine would. Run it on a
+    // snapshot() while the player is selecting, then fire plan.shots and adoptTargeting.
+    AIVolleyPlan planVolley(BoardData& target, int shots);
+    
+    // Take over the targeting state of a planner after its volley was fired for real
+    void adoptTargeting(const AILogic& planner);
+    
+    // planVolley on a background thread, against a copy of target taken now
+    // (target must not allocate from a session arena shared with the caller)
+    std::future<AIVolleyPlan> prefetchVolley(const BoardData& target, int shots) const;
+    
     // Getters
     BoardData& getBoard() { return aiBoard; }
     AIDifficulty getDifficulty() const { return difficulty; }
+    const FleetConfig& getFleet() const { return fleet; }
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,291 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: bot_process.cpp
+ * Description: Implementation of the bot child process and the protocol lines.
+ */
+
+#include "bot_process.hpp"
+#include "game_logic.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+#ifndef _WIN32
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+BotProcess::BotProcess()
+    : pid(-1), toBot(-1), fromBot(-1), inBuffer(BOT_READ_BUFFER), inStart(0), inEnd(0),
+      bytesSent(0), bytesReceived(0), writes(0) {
+}
+
+BotProcess::~BotProcess() {
+    stop();
+}
+
+#ifndef _WIN32
+
+// Fork and exec the bot with its stdin and stdout on two pipes
+bool BotProcess::start(const std::string& command, std::string& error) {
+    stop();
+
+    int input[2], output[2];
+    if (pipe(input) != 0) {
+        error = "pipe failed";
+        return false;
+    }
+    if (pipe(output) != 0) {
+        close(input[0]);
+        close(input[1]);
+        error = "pipe failed";
+        return false;
+    }
+
+    // A bot that dies mid-write must fail the write, not kill the driver
+    signal(SIGPIPE, SIG_IGN);
+
+    pid = fork();
+    if (pid < 0) {
+        close(input[0]);
+        close(input[1]);
+        close(output[0]);
+        close(output[1]);
+        error = "fork failed";
+        return false;
+    }
+    if (pid == 0) {
+        dup2(input[0], STDIN_FILENO);
+        dup2(output[1], STDOUT_FILENO);
+        close(input[0]);
+        close(input[1]);
+        close(output[0]);
+        close(output[1]);
+        execl("/bin/sh", "sh", "-c", command.c_str(), (char*)nullptr);
+        _exit(127);
+    }
+
+    close(input[0]);
+    close(output[1]);
+    toBot = input[1];
+    fromBot = output[0];
+    fcntl(toBot, F_SETFD, FD_CLOEXEC);
+    fcntl(fromBot, F_SETFD, FD_CLOEXEC);
+    outBuffer.clear();
+    inStart = inEnd = 0;
+    bytesSent = bytesReceived = writes = 0;
+    return true;
+}
+
+// Closing stdin is the bot's cue to exit if it ignores "quit"
+void BotProcess::stop() {
+    if (pid <= 0) return;
+
+    send("quit");
+    flush();
+    close(toBot);
+    close(fromBot);
+    toBot = fromBot = -1;
+
+    int status;
+    bool exited = false;
+    for (int waited = 0; waited < 1000 && !exited; waited += 10) {
+        exited = waitpid(pid, &status, WNOHANG) == pid;
+        if (!exited) usleep(10000);
+    }
+    if (!exited) {
+        kill(pid, SIGKILL);
+        waitpid(pid, &status, 0);
+    }
+    pid = -1;
+}
+
+// Write the whole queue, retrying short writes
+bool BotProcess::flush() {
+    if (outBuffer.empty()) return true;
+    if (toBot < 0) return false;
+
+    const char* data = outBuffer.data();
+    size_t remaining = outBuffer.size();
+    while (remaining > 0) {
+        ssize_t written = write(toBot, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            outBuffer.clear();
+            return false;
+        }
+        data += written;
+        remaining -= (size_t)written;
+        bytesSent += (unsigned long long)written;
+    }
+    writes++;
+    outBuffer.clear();
+    return true;
+}
+
+// Serve lines out of the read buffer, refilling it with as much as the pipe holds
+bool BotProcess::readLine(std::string& line) {
+    if (!flush() || fromBot < 0) return false;
+
+    while (true) {
+        char* begin = inBuffer.data() + inStart;
+        char* newline = (char*)memchr(begin, '\n', inEnd - inStart);
+        if (newline) {
+            line.assign(begin, newline);
+            if (!line.empty() && line[line.size() - 1] == '\r') line.erase(line.size() - 1);
+            inStart = (size_t)(newline - inBuffer.data()) + 1;
+            return true;
+        }
+
+        // Keep the partial line at the front, growing the buffer for very long lines
+        if (inStart > 0) {
+            memmove(inBuffer.data(), begin, inEnd - inStart);
+            inEnd -= inStart;
+            inStart = 0;
+        }
+        if (inEnd == inBuffer.size()) inBuffer.resize(inBuffer.size() * 2);
+
+        struct pollfd ready;
+        ready.fd = fromBot;
+        ready.events = POLLIN;
+        ready.revents = 0;
+        int polled = poll(&ready, 1, BOT_REPLY_TIMEOUT_MS);
+        if (polled < 0 && errno == EINTR) continue;
+        if (polled <= 0) return false;
+
+        ssize_t got = read(fromBot, inBuffer.data() + inEnd, inBuffer.size() - inEnd);
+        if (got < 0 && errno == EINTR) continue;
+        if (got <= 0) return false;
+        inEnd += (size_t)got;
+        bytesReceived += (unsigned long long)got;
+    }
+}
+
+#else
+
+bool BotProcess::start(const std::string& command, std::string& error) {
+    (void)command;
+    error = "external bots need a POSIX system";
+    return false;
+}
+
+void BotProcess::stop() {
+}
+
+bool BotProcess::flush() {
+    outBuffer.clear();
+    return false;
+}
+
+bool BotProcess::readLine(std::string& line) {
+    (void)line;
+    return false;
+}
+
+#endif
+
+void BotProcess::send(const std::string& line) {
+    outBuffer += line;
+    outBuffer += '\n';
+}
+
+// new <boardSize> <shotsPerTurn> <length>...
+std::string formatBotNewGame(const FleetConfig& fleet) {
+    std::string line = "new " + std::to_string(fleet.boardSize) + " " + std::to_string(fleet.shotsPerTurn);
+    for (const FleetEntry& entry : fleet.ships) {
+        for (int i = 0; i < entry.count; i++) line += " " + std::to_string(entry.length);
+    }
+    return line;
+}
+
+// fleet <x> <y> <h|v>... from the ships in placement order
+std::string formatBotFleet(const BoardData& board) {
+    std::string line = "fleet";
+    for (const ActiveShip& ship : board.myShips) {
+        // Horizontal ships are stored by their right end
+        int x = (ship.orientation == 1) ? ship.startCol : ship.startCol - ship.length + 1;
+        line += " " + std::to_string(x) + " " + std::to_string(ship.startRow) +
+                (ship.orientation == 1 ? " v" : " h");
+    }
+    return line;
+}
+
+// Check every ship against the board as it fills up, then build the cell map
+bool parseBotFleet(const std::string& line, const FleetConfig& fleet, BoardData& board, std::string& error) {
+    std::istringstream in(line);
+    std::string word;
+    if (!(in >> word) || word != "fleet") {
+        error = "expected fleet, got \"" + line.substr(0, 40) + "\"";
+        return false;
+    }
+
+    board.setIsHost(false);
+    board.initialize(fleet.boardSize);
+    std::vector<GamePiece> pieces;
+    GameLogic::initializeGamePieces(board, pieces, fleet);
+
+    int size = fleet.boardSize;
+    for (const GamePiece& piece : pieces) {
+        int x, y;
+        std::string axis;
+        int length = piece.Get_Piece_Length();
+        if (!(in >> x >> y >> axis) || (axis != "h" && axis != "v")) {
+            error = "fleet line too short or malformed";
+            return false;
+        }
+        bool vertical = (axis == "v");
+        int lastX = vertical ? x : x + length - 1;
+        int lastY = vertical ? y + length - 1 : y;
+        if (x < 0 || y < 0 || lastX >= size || lastY >= size) {
+            error = "ship of length " + std::to_string(length) + " off the board";
+            return false;
+        }
+        int orientation = vertical ? 1 : 2;
+        int peg = y * size + lastX;
+        if (GameLogic::checkStartingPeg(board, orientation, peg, length) != 1) {
+            error = "ships overlap at " + std::to_string(x) + "," + std::to_string(y);
+            return false;
+        }
+        board.addShip(orientation, peg, length, piece.Get_Piece_Symbol());
+    }
+    if (in >> word) {
+        error = "fleet line has extra ships";
+        return false;
+    }
+    board.buildShipCellMap();
+    return true;
+}
+
+// shots <x> <y>...
+bool parseBotShots(const std::string& line, int boardSize, int maxShots, std::vector<AICoordinates>& shots) {
+    shots.clear();
+    const char* cursor = line.c_str();
+    if (strncmp(cursor, "shots", 5) != 0) return false;
+    cursor += 5;
+
+    while (true) {
+        char* end;
+        long x = strtol(cursor, &end, 10);
+        if (end == cursor) break;
+        cursor = end;
+        long y = strtol(cursor, &end, 10);
+        if (end == cursor) return false;
+        cursor = end;
+        if (x < 0 || x >= boardSize || y < 0 || y >= boardSize || (int)shots.size() == maxShots) return false;
+
+        AICoordinates shot;
+        shot.x = (int)x;
+        shot.y = (int)y;
+        shots.push_back(shot);
+    }
+    while (*cursor == ' ') cursor++;
+    return *cursor == '\0' && !shots.empty();
+}
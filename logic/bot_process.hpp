@@ -0,0 +1,92 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: bot_process.hpp
+ * Description: Header file for the external bot protocol. BotProcess runs a bot as
+ *              a child process and talks to it over its stdin/stdout; the helpers
+ *              below format and parse the protocol lines. Outgoing lines are queued
+ *              and written in one go when the driver next waits for a reply, so a
+ *              turn costs one write and one read however many lines it takes.
+ *
+ * Protocol (one message per line, fields separated by single spaces, x/y from 0):
+ *   driver: new <boardSize> <shotsPerTurn> <length>...   one length per ship
+ *   bot:    fleet <x> <y> <h|v>...                       one ship per length, same order;
+ *                                                         (x, y) is the top/left cell
+ *   driver: volley <n>
+ *   bot:    shots <x> <y>...                             1 to n shots
+ *   driver: results <r>...                               per shot: 0 miss, 1 hit, 2 sunk
+ *   driver: end <win|loss>                               game over, a new game may follow
+ *   driver: quit                                         the bot should exit
+ */
+
+#ifndef BOT_PROCESS_HPP
+#define BOT_PROCESS_HPP
+
+#include "../data/board_data.hpp"
+#include "../data/game_state.hpp"
+#include "../data/fleet_config.hpp"
+#include <string>
+#include <vector>
+
+const int BOT_REPLY_TIMEOUT_MS = 10000;     // Longest wait for one reply line
+const size_t BOT_READ_BUFFER = 65536;
+
+class BotProcess {
+public:
+    BotProcess();
+    ~BotProcess();
+
+    // Run command through /bin/sh with pipes on its stdin and stdout
+    bool start(const std::string& command, std::string& error);
+
+    // Ask the bot to quit and reap it (killed if it does not exit within a second)
+    void stop();
+
+    bool isRunning() const { return pid > 0; }
+
+    // Queue one line; nothing is written until flush() or readLine()
+    void send(const std::string& line);
+
+    // Write every queued line
+    bool flush();
+
+    // Flush, then read the next reply line (without the newline)
+    // Returns false if the bot exited, timed out or the pipe failed
+    bool readLine(std::string& line);
+
+    unsigned long long getBytesSent() const { return bytesSent; }
+    unsigned long long getBytesReceived() const { return bytesReceived; }
+    unsigned long long getWrites() const { return writes; }     // write() calls, i.e. round trips
+
+private:
+    int pid;
+    int toBot;                          // Bot's stdin
+    int fromBot;                        // Bot's stdout
+    std::string outBuffer;
+    std::vector<char> inBuffer;
+    size_t inStart;                     // Unread bytes are inBuffer[inStart, inEnd)
+    size_t inEnd;
+    unsigned long long bytesSent;
+    unsigned long long bytesReceived;
+    unsigned long long writes;
+
+    BotProcess(const BotProcess&);
+    BotProcess& operator=(const BotProcess&);
+};
+
+// "new" line for fleet
+std::string formatBotNewGame(const FleetConfig& fleet);
+
+// "fleet" line describing the ships placed on board
+std::string formatBotFleet(const BoardData& board);
+
+// Place the ships of a "fleet" line on board (initialized for fleet)
+// Returns false, with the reason in error, for a malformed line or an illegal placement
+bool parseBotFleet(const std::string& line, const FleetConfig& fleet, BoardData& board, std::string& error);
+
+// Read the shots of a "shots" line: 1 to maxShots pairs, each on the board
+bool parseBotShots(const std::string& line, int boardSize, int maxShots, std::vector<AICoordinates>& shots);
+
+#endif
@@ -0,0 +1,235 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: endgame_solver.cpp
+ * Description: Implementation of the exact endgame solver: a depth-first search over
+ *              ship placements, longest ships first, with same-length ships placed in
+ *              increasing order so each layout is counted once.
+ */
+
+#include "endgame_solver.hpp"
+#include <cstring>
+#include <unordered_map>
+
+namespace {
+
+// The placement bound overcounts (it ignores overlaps and open hits); try the exact
+// search while it is within this factor of the layout limit
+const double ESTIMATE_SLACK = 4;
+
+// Search steps allowed per layout of the limit before giving up
+const long NODES_PER_LAYOUT = 64;
+
+// A horizontal ship is one row with a run of bits; a vertical ship is `rows` rows with one bit
+struct Placement {
+    int y;
+    int rows;
+    unsigned int mask;
+};
+
+int bitCount(unsigned int bits) {
+    int count = 0;
+    for (; bits; bits &= bits - 1) count++;
+    return count;
+}
+
+class EndgameSearch {
+public:
+    EndgameSearch(const unsigned int* blockedRows, const unsigned int* hitRows, int boardSize,
+                  const std::vector<int>& shipCounts, long maxLayouts, EndgameResult& result)
+        : size(boardSize), hits(hitRows), limit(maxLayouts), result(result), nodes(0), aborted(false),
+          openHits(0) {
+        memset(occupied, 0, sizeof(occupied));
+        for (int y = 0; y < size; y++) openHits += bitCount(hits[y]);
+
+        // Longest ships first: they have the fewest placements and prune the most
+        for (int length = (int)shipCounts.size() - 1; length >= 1; length--) {
+            for (int c = 0; c < shipCounts[length]; c++) ships.push_back(length);
+        }
+        cellsAfter.assign(ships.size() + 1, 0);
+        for (int i = (int)ships.size() - 1; i >= 0; i--) cellsAfter[i] = cellsAfter[i + 1] + ships[i];
+
+        placements.resize(shipCounts.size());
+        for (int length = 1; length < (int)shipCounts.size(); length++) {
+            if (shipCounts[length] > 0) addPlacements(blockedRows, length);
+        }
+        budget = maxLayouts * NODES_PER_LAYOUT;
+    }
+
+    // Upper bound on the layout count: each ship class chosen independently, overlaps ignored
+    double estimate() const {
+        double bound = 1;
+        int i = 0;
+        while (i < (int)ships.size()) {
+            int length = ships[i], count = 0;
+            while (i < (int)ships.size() && ships[i] == length) { i++; count++; }
+            double options = (double)placements[length].size();
+            for (int c = 0; c < count; c++) bound = bound * (options - c) / (c + 1);
+        }
+        return bound;
+    }
+
+    bool run() {
+        result.layouts = 0;
+        result.cover.assign(size * size, 0);
+        search(0, 0);
+        if (aborted) result.layouts = -1;
+        return result.layouts > 0;
+    }
+
+private:
+    // Every placement clear of blocked cells that is not made only of known hits
+    void addPlacements(const unsigned int* blockedRows, int length) {
+        std::vector<Placement>& list = placements[length];
+        unsigned int run = length >= 32 ? 0xffffffffu : ((1u << length) - 1);
+        for (int y = 0; y < size; y++) {
+            for (int x = 0; x + length <= size; x++) {
+                unsigned int mask = run << x;
+                if (!(blockedRows[y] & mask) && (mask & ~hits[y])) list.push_back(Placement{y, 1, mask});
+            }
+        }
+        if (length == 1) return;
+        for (int y = 0; y + length <= size; y++) {
+            for (int x = 0; x < size; x++) {
+                unsigned int bit = 1u << x;
+                bool clear = true, open = false;
+                for (int k = 0; k < length && clear; k++) {
+                    clear = !(blockedRows[y + k] & bit);
+                    if (!(hits[y + k] & bit)) open = true;
+                }
+                if (clear && open) list.push_back(Placement{y, length, bit});
+            }
+        }
+    }
+
+    bool fits(const Placement& p) const {
+        for (int r = 0; r < p.rows; r++) {
+            if (occupied[p.y + r] & p.mask) return false;
+        }
+        return true;
+    }
+
+    // Place (sign 1) or remove (sign -1) a ship, keeping the count of uncovered hits
+    void toggle(const Placement& p, int sign) {
+        for (int r = 0; r < p.rows; r++) {
+            occupied[p.y + r] ^= p.mask;
+            openHits -= sign * bitCount(hits[p.y + r] & p.mask);
+        }
+    }
+
+    // 64-bit FNV-1a of the partial layout and the search position
+    unsigned long long stateKey(int ship, int first) const {
+        unsigned long long hash = 14695981039346656037ull;
+        for (int y = 0; y < size; y++) hash = (hash ^ occupied[y]) * 1099511628211ull;
+        hash = (hash ^ (unsigned int)ship) * 1099511628211ull;
+        return (hash ^ (unsigned int)first) * 1099511628211ull;
+    }
+
+    // The stored state at `offset` is the current one (rows, ship, first)
+    bool sameState(size_t offset, int ship, int first) const {
+        const unsigned int* stored = &deadStates[offset];
+        return stored[size] == (unsigned int)ship && stored[size + 1] == (unsigned int)first &&
+               memcmp(stored, occupied, size * sizeof(unsigned int)) == 0;
+    }
+
+    // Dead only if a stored state matches in full: a hash collision is never a prune
+    bool isDead(unsigned long long key, int ship, int first) const {
+        auto range = dead.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (sameState(it->second, ship, first)) return true;
+        }
+        return false;
+    }
+
+    void markDead(unsigned long long key, int ship, int first) {
+        dead.insert(std::make_pair(key, deadStates.size()));
+        deadStates.insert(deadStates.end(), occupied, occupied + size);
+        deadStates.push_back((unsigned int)ship);
+        deadStates.push_back((unsigned int)first);
+    }
+
+    // A complete layout: count it and its cells
+    void record() {
+        result.layouts++;
+        if (result.layouts > limit) {
+            aborted = true;
+            return;
+        }
+        for (const Placement* p : stack) {
+            for (int r = 0; r < p->rows; r++) {
+                unsigned int* row = &result.cover[(p->y + r) * size];
+                for (unsigned int bits = p->mask; bits; bits &= bits - 1) {
+                    int x = 0;
+                    while (!((bits >> x) & 1)) x++;
+                    row[x]++;
+                }
+            }
+        }
+    }
+
+    // Place ship `ship` and the rest; same-length ships use placements from `first` on
+    // Returns the number of layouts completed below this point
+    long search(int ship, int first) {
+        if (aborted) return 0;
+        if (++nodes > budget) {
+            aborted = true;
+            return 0;
+        }
+        if (openHits > cellsAfter[ship]) return 0;
+        if (ship == (int)ships.size()) {
+            record();
+            return 1;
+        }
+
+        unsigned long long key = stateKey(ship, first);
+        if (isDead(key, ship, first)) return 0;
+
+        int length = ships[ship];
+        const std::vector<Placement>& list = placements[length];
+        long found = 0;
+        for (int i = first; i < (int)list.size() && !aborted; i++) {
+            if (!fits(list[i])) continue;
+            toggle(list[i], 1);
+            stack.push_back(&list[i]);
+            bool sameNext = ship + 1 < (int)ships.size() && ships[ship + 1] == length;
+            found += search(ship + 1, sameNext ? i + 1 : 0);
+            stack.pop_back();
+            toggle(list[i], -1);
+        }
+        if (found == 0 && !aborted) markDead(key, ship, first);
+        return found;
+    }
+
+    int size;
+    const unsigned int* hits;
+    long limit;
+    EndgameResult& result;
+    long nodes;
+    long budget;                                    // Search steps allowed before giving up
+    bool aborted;
+    int openHits;                                   // Hits no placed ship covers yet
+    unsigned int occupied[ENDGAME_MAX_BOARD];
+    std::vector<int> ships;                         // Remaining ship lengths, longest first
+    std::vector<int> cellsAfter;                    // Cells of ships[i..] combined
+    std::vector<std::vector<Placement>> placements; // Legal placements by length
+    std::vector<const Placement*> stack;            // Placements of the current partial layout
+    std::unordered_multimap<unsigned long long, size_t> dead; // Partial layouts with no completion:
+                                                              // key to offset in deadStates
+    std::vector<unsigned int> deadStates;           // Their rows, ship and first, size + 2 words each
+};
+
+} // namespace
+
+// Bound the layout count cheaply, then enumerate exactly
+bool solveEndgame(const unsigned int* blockedRows, const unsigned int* hitRows, int boardSize,
+                  const std::vector<int>& shipCounts, long maxLayouts, EndgameResult& result) {
+    result.layouts = -1;
+    result.cover.clear();
+    if (boardSize <= 0 || boardSize > ENDGAME_MAX_BOARD) return false;
+
+    EndgameSearch search(blockedRows, hitRows, boardSize, shipCounts, maxLayouts, result);
+    if (search.estimate() > (double)maxLayouts * ESTIMATE_SLACK) return false;
+    return search.run();
+}
@@ -0,0 +1,38 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: endgame_solver.hpp
+ * Description: Header file for the exact endgame solver. Once few ships remain, it
+ *              enumerates every placement of the remaining fleet that agrees with the
+ *              shots so far (no ship on a miss or sunk cell, every open hit covered,
+ *              no ship made only of hits) and counts how many of them cover each cell.
+ *              Rows are bitmasks, so overlap tests are one AND per row; partial layouts
+ *              that cannot be completed are remembered and skipped when reached again.
+ */
+
+#ifndef ENDGAME_SOLVER_HPP
+#define ENDGAME_SOLVER_HPP
+
+#include <vector>
+
+const int ENDGAME_MAX_BOARD = 32;           // One row per 32-bit mask
+const long ENDGAME_MAX_LAYOUTS = 5000;      // Above this, sampling is cheaper than solving
+
+// Consistent layouts of the remaining fleet
+struct EndgameResult {
+    long layouts;                           // Consistent layouts (-1 = too many to count)
+    std::vector<unsigned int> cover;        // Layouts with a ship on each cell (row-major)
+};
+
+// Enumerate the layouts of the remaining ships
+// blockedRows: bit x of blockedRows[y] set for misses and sunk cells
+// hitRows: bit x of hitRows[y] set for hits on ships not yet sunk
+// shipCounts: shipCounts[length] = remaining ships of that length
+// Returns false if the board is too large, the layouts number more than maxLayouts
+// (the search stops early; layouts is -1), or no layout fits the shots (layouts is 0)
+bool solveEndgame(const unsigned int* blockedRows, const unsigned int* hitRows, int boardSize,
+                  const std::vector<int>& shipCounts, long maxLayouts, EndgameResult& result);
+
+#endif
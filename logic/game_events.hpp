@@ -0,0 +1,97 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: game_events.hpp
+ * Description: Header file defining the typed game events emitted by the turn engine,
+ *              the lock-free single-producer/single-consumer ring that carries them,
+ *              and the consumer interface implemented by the renderer, network sender
+ *              and replay logger.
+ */
+
+#ifndef GAME_EVENTS_HPP
+#define GAME_EVENTS_HPP
+
+#include <atomic>
+#include <cstddef>
+
+// Which side fired the shots an event describes
+const int PLAYER_SIDE = 0;   // Local player shooting at the enemy board
+const int ENEMY_SIDE = 1;    // Opponent shooting at the local player's board
+
+// Event types, in the order they are emitted for a volley
+enum GameEventType {
+    EVENT_VOLLEY_BEGIN = 0,  // value = shots announced for the volley
+    EVENT_MISS,              // shot at (x, y) missed
+    EVENT_HIT,               // shot at (x, y) hit a ship that is still afloat
+    EVENT_SUNK,              // shot at (x, y) sank a ship; value = number of SUNK_CELL events that follow
+    EVENT_SUNK_CELL,         // (x, y) belongs to the ship sunk by the preceding EVENT_SUNK
+    EVENT_VOLLEY_END,        // value = wounded cells left by the volley
+    EVENT_GAME_OVER          // value = winning side
+};
+
+// One event; small and trivially copyable so the ring can hold it by value
+struct GameEvent {
+    unsigned char type;      // GameEventType
+    unsigned char side;      // PLAYER_SIDE or ENEMY_SIDE
+    short x;                 // Column (shot events)
+    short y;                 // Row (shot events)
+    short value;             // Type-specific payload, see GameEventType
+    int turn;                // GameState::turnNumber when the event was emitted
+};
+
+// Lock-free ring for one producer thread and one consumer thread
+// Capacity must be a power of two; one slot is always left empty
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+    SpscRing() : head(0), tail(0) {}
+
+    // Producer side; returns false if the ring is full
+    bool push(const T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        size_t next = (h + 1) & (Capacity - 1);
+        if (next == tail.load(std::memory_order_acquire)) return false;
+        slots[h] = item;
+        head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side; returns false if the ring is empty
+    bool pop(T& item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return false;
+        item = slots[t];
+        tail.store((t + 1) & (Capacity - 1), std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+private:
+    T slots[Capacity];
+    std::atomic<size_t> head;   // Next slot to write (owned by producer)
+    std::atomic<size_t> tail;   // Next slot to read (owned by consumer)
+};
+
+// Ring used between the turn engine and its consumers
+const size_t GAME_EVENT_RING_SIZE = 4096;
+typedef SpscRing<GameEvent, GAME_EVENT_RING_SIZE> GameEventRing;
+
+// Receiver of game events (renderer, network sender, replay logger, ...)
+class GameEventConsumer {
+public:
+    virtual ~GameEventConsumer() {}
+    virtual void onEvent(const GameEvent& event) = 0;
+};
+
+// Pop every queued event and hand it to each consumer in order
+// Returns the number of events delivered
+int drainGameEvents(GameEventRing& ring, GameEventConsumer* const* consumers, int consumerCount);
+
+#endif
@@ -10,6 +10,7 @@
  */
 
 #include "game_logic.hpp"
+#include "../data/trace.hpp"
 #include <chrono>
 #include <ctime>
 #include <cstdlib>
@@ -28,17 +29,34 @@ void GameLogic::initializeGame(GameState& state, int boardSize, int shotsPerTurn
     state.enemyShipsRemaining = state.totalShips;
 }
 
+// Initialize game state for an explicit fleet definition
+// state: game state object to initialize
+// fleet: board size, ship lengths/counts and shots per turn
+// isHost: whether this side moves first
+void GameLogic::initializeGame(GameState& state, const FleetConfig& fleet, bool isHost) {
+    state.initialize(fleet.boardSize, fleet.shotsPerTurn, isHost);
+    state.totalShips = fleet.getTotalShips();
+    state.maxHits = fleet.getTotalShipCells();
+    state.playerShipsRemaining = state.totalShips;
+    state.enemyShipsRemaining = state.totalShips;
+}
+
 // Initialize game pieces (ships) based on board configuration
 // board: board to initialize pieces for
 // pieces: vector to store created game pieces
 void GameLogic::initializeGamePieces(BoardData& board, std::vector<GamePiece>& pieces) {
+    initializeGamePieces(board, pieces, getFleetConfig(board.boardSize));
+}
+
+// Initialize game pieces (ships) from an explicit fleet definition
+// board: board to initialize pieces for
+// pieces: vector to store created game pieces (ship id == index in this vector)
+// fleet: ship lengths and counts, longest first
+void GameLogic::initializeGamePieces(BoardData& board, std::vector<GamePiece>& pieces, const FleetConfig& fleet) {
     pieces.clear();
     board.shipStatus.clear();
     board.myShips.clear();
     
-    // Get ship configuration for this board size
-    ShipConfiguration config = getShipConfig(board.boardSize);
-    
     int shipCounter = 0;
     
     // Lambda to create ActiveShip structure
@@ -55,36 +73,14 @@ void GameLogic::initializeGamePieces(BoardData& board, std::vector<GamePiece>& p
         return s;
     };
 
-    // Create 4-deck ships (battleships)
-    for (int i = 0; i < config.fourDeck; i++) {
-        char symbol = 'A' + (shipCounter % 26);
-        pieces.push_back(GamePiece(4, symbol));
-        board.shipStatus[symbol] = createShip(4, symbol);
-        shipCounter++;
-    }
-    
-    // Create 3-deck ships (cruisers)
-    for (int i = 0; i < config.threeDeck; i++) {
-        char symbol = 'A' + (shipCounter % 26);
-        pieces.push_back(GamePiece(3, symbol));
-        board.shipStatus[symbol] = createShip(3, symbol);
-        shipCounter++;
-    }
-    
-    // Create 2-deck ships (destroyers)
-    for (int i = 0; i < config.twoDeck; i++) {
-        char symbol = 'A' + (shipCounter % 26);
-        pieces.push_back(GamePiece(2, symbol));
-        board.shipStatus[symbol] = createShip(2, symbol);
-        shipCounter++;
-    }
-    
-    // Create 1-deck ships (submarines)
-    for (int i = 0; i < config.oneDeck; i++) {
-        char symbol = 'A' + (shipCounter % 26);
-        pieces.push_back(GamePiece(1, symbol));
-        board.shipStatus[symbol] = createShip(1, symbol);
-        shipCounter++;
+    // Create ships class by class; symbols are display-only and wrap after 26 ships
+    for (const auto& entry : fleet.ships) {
+        for (int i = 0; i < entry.count; i++) {
+            char symbol = getShipSymbol(shipCounter);
+            pieces.push_back(GamePiece(entry.length, symbol));
+            board.shipStatus[symbol] = createShip(entry.length, symbol);
+            shipCounter++;
+        }
     }
 }
 
@@ -92,58 +88,50 @@ void GameLogic::initializeGamePieces(BoardData& board, std::vector<GamePiece>& p
 // board: board to place ships on
 // pieces: vector of ships to place
 void GameLogic::generateBoardPlacement(BoardData& board, const std::vector<GamePiece>& pieces) {
+    TRACE_SCOPE("GameLogic::generateBoardPlacement");
     // Use high-resolution clock for better randomness
     auto seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
 
     // Different seeds for host and client to ensure different boards
-    if (board.isHost) {
-        srand(static_cast<unsigned int>(seed) + 3000);
-    } else {
-        srand(static_cast<unsigned int>(seed));
-    }
+    GameRng rng(static_cast<unsigned long long>(seed) + (board.isHost ? 3000 : 0));
+    placePieces(board, pieces, rng);
+}
 
-    // Attempt to place each ship
-    for (size_t i = 0; i < pieces.size(); i++) {
-        int starting_peg = (rand() % (board.boardSize * board.boardSize));
-        int orientation = (rand() % 2) + 1;  // 1 = vertical, 2 = horizontal
-        int piece_length = pieces[i].Get_Piece_Length();
-        char piece_symbol = pieces[i].Get_Piece_Symbol();
-        
-        int ret = 0;
-        int attempts = 0;
-        const int MAX_ATTEMPTS = 1000;
-        
-        // Try to find valid placement
-        while ((ret = checkStartingPeg(board, orientation, starting_peg, piece_length)) != 1) {
-            if (ret == 2) {
-                // Out of bounds - try flipping orientation
-                orientation = (orientation == 1) ? 2 : 1;
-                ret = checkStartingPeg(board, orientation, starting_peg, piece_length);
-                if (ret == 1) {
-                    break;
-                }
-            }
+// Generate random placement drawing from the caller's engine (AIs with their own seed)
+void GameLogic::generateBoardPlacement(BoardData& board, const std::vector<GamePiece>& pieces, GameRng& rng) {
+    TRACE_SCOPE("GameLogic::generateBoardPlacement");
+    placePieces(board, pieces, rng);
+}
 
-            // Try new random position and orientation
-            starting_peg = (rand() % (board.boardSize * board.boardSize));
-            orientation = (rand() % 2) + 1;
-            attempts++;
-            
-            // If can't place after many attempts, restart entire board
-            if (attempts > MAX_ATTEMPTS) {
-                board.clear();
-                i = -1;  // Restart from beginning
-                break;
-            }
-        }
-        
-        // Place ship if valid position found
-        if (i >= 0 && ret == 1) {
-            board.addShip(orientation, starting_peg, piece_length, piece_symbol);
+// Initialize game pieces for a sparse board from an explicit fleet definition
+// board: sparse board to reset (ships are registered by generateBoardPlacement)
+// pieces: vector to store created game pieces (ship id == index in this vector)
+// fleet: ship lengths and counts, longest first
+void GameLogic::initializeGamePieces(SparseBoardData& board, std::vector<GamePiece>& pieces, const FleetConfig& fleet) {
+    pieces.clear();
+    board.initialize(fleet.boardSize);
+
+    int shipCounter = 0;
+    for (const auto& entry : fleet.ships) {
+        for (int i = 0; i < entry.count; i++) {
+            pieces.push_back(GamePiece(entry.length, getShipSymbol(shipCounter)));
+            shipCounter++;
         }
     }
 }
 
+// Generate random placement for all ships on a sparse board
+// Each attempt probes only the cells the ship would cover, so the cost depends on
+// the fleet and never on board area
+// board: sparse board to place ships on
+// pieces: vector of ships to place
+void GameLogic::generateBoardPlacement(SparseBoardData& board, const std::vector<GamePiece>& pieces) {
+    TRACE_SCOPE("GameLogic::generateBoardPlacement (sparse)");
+    auto seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    GameRng rng(static_cast<unsigned long long>(seed) + (board.isHost ? 3000 : 0));
+    placePieces(board, pieces, rng);
+}
+
 // Check if a ship can be placed starting at given position
 // board: board to check placement on
 // orientation: 1 = vertical (down), 2 = horizontal (left)
@@ -151,28 +139,7 @@ void GameLogic::generateBoardPlacement(BoardData& board, const std::vector<GameP
 // piece_length: length of ship to place
 // Returns: 1 = valid, 2 = out of bounds, 3 = collides with existing ship
 short GameLogic::checkStartingPeg(const BoardData& board, int orientation, int starting_peg, int piece_length) {
-    if (orientation == 1) {
-        // Vertical placement (going down)
-        for (int j = 0; j < piece_length; j++) {
-            if ((starting_peg / board.boardSize) + j >= board.boardSize) {
-                return 2;  // Out of bounds
-            } else if (board.boardArray[(starting_peg / board.boardSize) + j][(starting_peg % board.boardSize)] != 'w') {
-                return 3;  // Collision with existing ship
-            }
-        }
-        return 1;  // Valid placement
-    } else {
-        // Horizontal placement (going left)
-        for (int j = 0; j < piece_length; j++) {
-            if ((starting_peg % board.boardSize) - j < 0) {
-                return 2;  // Out of bounds
-            }
-            if (board.boardArray[(starting_peg / board.boardSize)][(starting_peg % board.boardSize) - j] != 'w') {
-                return 3;  // Collision with existing ship
-            }
-        }
-        return 1;  // Valid placement
-    }
+    return board.checkStartingPeg(orientation, starting_peg, piece_length);
 }
 
 // Place a ship manually at specified position
@@ -187,16 +154,13 @@ bool GameLogic::placeShip(BoardData& board, int gridX, int gridY, int orientatio
         return false;
     }
     
+    // Register the ship so shots can resolve it by id
     if (orientation == 0) {
         // Horizontal placement (left from starting point)
-        for (int i = 0; i < length; i++) {
-            board.boardArray[gridY][gridX - i] = symbol;
-        }
+        board.addShip(0, gridY * board.boardSize + gridX, length, symbol);
     } else {
-        // Vertical placement (up from starting point)
-        for (int i = 0; i < length; i++) {
-            board.boardArray[gridY - i][gridX] = symbol;
-        }
+        // Vertical placement (up from starting point): addShip extends down from the top cell
+        board.addShip(1, (gridY - length + 1) * board.boardSize + gridX, length, symbol);
     }
     return true;
 }
@@ -15,21 +15,41 @@
 #include "../data/game_state.hpp"
 #include "../data/board_data.hpp"
 #include "../data/ship_data.hpp"
+#include "../data/fleet_config.hpp"
+#include "../data/sparse_board.hpp"
+#include <random>
 #include <vector>
 #include <string>
 
+// Random source for placement; 64-bit so a peg can land on any cell of a sparse board
+typedef std::mt19937_64 GameRng;
+
 class GameLogic {
 public:
     // Initialize game state with settings
     static void initializeGame(GameState& state, int boardSize, int shotsPerTurn, bool isHost);
     
+    // Initialize game state for a custom fleet (board size, ship totals and shots per turn)
+    static void initializeGame(GameState& state, const FleetConfig& fleet, bool isHost);
+    
     // Board generation methods
     static bool generateRandomBoard(BoardData& board, bool isHost);
     static bool generateManualBoard(BoardData& board);
     
     // Ship initialization and placement
     static void initializeGamePieces(BoardData& board, std::vector<GamePiece>& pieces);
+    static void initializeGamePieces(BoardData& board, std::vector<GamePiece>& pieces, const FleetConfig& fleet);
     static void generateBoardPlacement(BoardData& board, const std::vector<GamePiece>& pieces);
+    static void generateBoardPlacement(BoardData& board, const std::vector<GamePiece>& pieces, GameRng& rng);
+    
+    // Random placement on any board type with getBoardSize, checkStartingPeg, addShip
+    // and clear (BoardData, SparseBoardData), drawing from rng
+    template <typename Board>
+    static void placePieces(Board& board, const std::vector<GamePiece>& pieces, GameRng& rng);
+    
+    // Placement experiment on very large sparse boards; cost scales with ship cells, not board area
+    static void initializeGamePieces(SparseBoardData& board, std::vector<GamePiece>& pieces, const FleetConfig& fleet);
+    static void generateBoardPlacement(SparseBoardData& board, const std::vector<GamePiece>& pieces);
     
     // Placement validation
     static short checkStartingPeg(const BoardData& board, int orientation, int starting_peg, int piece_length);
@@ -56,4 +76,51 @@ public:
     static int countRemainingShips(const std::vector<std::vector<char>>& boardArray, int size);
 };
 
+// Place each piece at a random legal spot; after MAX_ATTEMPTS misses for one ship the
+// whole board is cleared and placement starts over
+template <typename Board>
+void GameLogic::placePieces(Board& board, const std::vector<GamePiece>& pieces, GameRng& rng) {
+    const int MAX_ATTEMPTS = 1000;
+    long long cells = (long long)board.getBoardSize() * board.getBoardSize();
+    std::uniform_int_distribution<long long> randomPeg(0, cells - 1);
+    std::uniform_int_distribution<int> randomOrientation(1, 2);  // 1 = vertical, 2 = horizontal
+    
+    for (int i = 0; i < (int)pieces.size(); i++) {
+        long long starting_peg = randomPeg(rng);
+        int orientation = randomOrientation(rng);
+        int piece_length = pieces[i].Get_Piece_Length();
+        
+        int ret = 0;
+        int attempts = 0;
+        
+        // Try to find valid placement
+        while ((ret = board.checkStartingPeg(orientation, starting_peg, piece_length)) != 1) {
+            if (ret == 2) {
+                // Out of bounds - try flipping orientation
+                orientation = (orientation == 1) ? 2 : 1;
+                ret = board.checkStartingPeg(orientation, starting_peg, piece_length);
+                if (ret == 1) {
+                    break;
+                }
+            }
+            
+            // Try new random position and orientation
+            starting_peg = randomPeg(rng);
+            orientation = randomOrientation(rng);
+            attempts++;
+            
+            // If can't place after many attempts, restart entire board
+            if (attempts > MAX_ATTEMPTS) {
+                board.clear();
+                i = -1;
+                break;
+            }
+        }
+        
+        if (i >= 0 && ret == 1) {
+            board.addShip(orientation, starting_peg, piece_length, pieces[i].Get_Piece_Symbol());
+        }
+    }
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,483 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: net_session.cpp
+ * Description: Implementation of the resumable network session.
+ */
+
+#include "net_session.hpp"
+#include "../data/trace.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #define SLEEP_MS(x) Sleep(x)
+#else
+    #include <errno.h>
+    #include <sys/select.h>
+    #define SLEEP_MS(x) usleep((x) * 1000)
+#endif
+
+#ifndef MSG_NOSIGNAL
+    #define MSG_NOSIGNAL 0
+#endif
+
+// Whether the last socket error is a receive timeout rather than a broken connection
+static bool timedOut() {
+    #ifdef _WIN32
+        return WSAGetLastError() == WSAETIMEDOUT;
+    #else
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    #endif
+}
+
+NetSession::NetSession()
+    : sock(INVALID_SOCKET_VALUE), listenSocket(INVALID_SOCKET_VALUE), port(PORT), isHost(false),
+      sessionId(0), resumeCount(0), broken(false), handshakeTimeoutMs(NET_HANDSHAKE_TIMEOUT_SEC * 1000), outSeq(-1), outCount(0), inSeq(-1), inCount(0),
+      established(false), heartbeatIntervalMs(NET_HEARTBEAT_INTERVAL_MS), pingId(0), pingOutstanding(false), peerAnswered(false),
+      probeTimeoutSec(NET_SETUP_TIMEOUT_SEC), bytesSent(0), bytesReceived(0) {
+}
+
+NetSession::~NetSession() {
+    close();
+}
+
+// Write one frame; fails fast once the connection is known to be broken
+bool NetSession::sendMessage(unsigned int type, int seq, int index, int a, int b) {
+    if (broken || sock == INVALID_SOCKET_VALUE) return false;
+
+    unsigned int frame[5];
+    frame[0] = htonl(type);
+    frame[1] = htonl((unsigned int)seq);
+    frame[2] = htonl((unsigned int)index);
+    frame[3] = htonl((unsigned int)a);
+    frame[4] = htonl((unsigned int)b);
+
+    const char* data = (const char*)frame;
+    int remaining = sizeof(frame);
+    while (remaining > 0) {
+        int sent = send(sock, data, remaining, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            broken = true;
+            return false;
+        }
+        data += sent;
+        remaining -= sent;
+    }
+    bytesSent += sizeof(frame);
+    return true;
+}
+
+// Send a ping when one is due; fail if the outstanding one went unanswered too long
+bool NetSession::checkHeartbeat() {
+    if (!established) return true;    // Never interleave a ping with the handshake
+
+    Clock::time_point now = Clock::now();
+    if (pingOutstanding) {
+        int timeoutSec = peerAnswered ? NET_PEER_TIMEOUT_SEC : probeTimeoutSec;
+        if (now - pingSentAt > std::chrono::seconds(timeoutSec)) {
+            broken = true;
+            return false;
+        }
+        return true;
+    }
+    if (now - pingSentAt < std::chrono::milliseconds(heartbeatIntervalMs)) return true;
+
+    pingOutstanding = true;
+    pingSentAt = now;
+    return sendMessage(NET_PING, 0, ++pingId, 0, 0);
+}
+
+// Wait until the socket has data, pinging meanwhile; fails once the deadline passes
+bool NetSession::waitReadable(Clock::time_point deadline) {
+    while (true) {
+        if (!checkHeartbeat()) return false;
+        if (Clock::now() >= deadline) {
+            broken = true;
+            return false;
+        }
+
+        fd_set readSet;
+        FD_ZERO(&readSet);
+        FD_SET(sock, &readSet);
+        struct timeval tv;
+        tv.tv_sec = 0;
+        tv.tv_usec = 250000;
+        int ready = select((int)sock + 1, &readSet, nullptr, nullptr, &tv);
+        if (ready > 0) return true;
+        if (ready < 0) {
+            #ifndef _WIN32
+                if (errno == EINTR) continue;
+            #endif
+            broken = true;
+            return false;
+        }
+    }
+}
+
+// Answer pings and time pongs; returns true if the message was one of them
+bool NetSession::handleControl(const NetMessage& message) {
+    if (message.type == NET_PING) {
+        sendMessage(NET_PONG, 0, message.index, 0, 0);
+        return true;
+    }
+    if (message.type == NET_PONG) {
+        if (pingOutstanding && message.index == pingId) {
+            // The first answer may include the peer's setup time, so it is not sampled
+            if (peerAnswered) {
+                rtt.add(std::chrono::duration<double, std::milli>(Clock::now() - pingSentAt).count());
+            }
+            peerAnswered = true;
+            pingOutstanding = false;
+        }
+        return true;
+    }
+    return false;
+}
+
+// Read one frame; while waiting for it the heartbeat keeps running
+bool NetSession::readMessage(NetMessage& message, Clock::time_point deadline) {
+    if (broken || sock == INVALID_SOCKET_VALUE) return false;
+
+    unsigned int frame[5];
+    char* data = (char*)frame;
+    int remaining = sizeof(frame);
+    while (remaining > 0) {
+        if (remaining == (int)sizeof(frame) && !waitReadable(deadline)) return false;
+        int received = recv(sock, data, remaining, 0);
+        if (received < 0 && timedOut()) continue;
+        if (received <= 0) {
+            broken = true;
+            return false;
+        }
+        data += received;
+        remaining -= received;
+    }
+
+    bytesReceived += sizeof(frame);
+    message.type = ntohl(frame[0]);
+    message.seq = ntohl(frame[1]);
+    message.index = ntohl(frame[2]);
+    message.a = (int)ntohl(frame[3]);
+    message.b = (int)ntohl(frame[4]);
+    return true;
+}
+
+// Handle a message the peer re-sent after a resume; returns true if it was consumed
+bool NetSession::isStale(const NetMessage& message) {
+    if (message.type == NET_VOLLEY && (int)message.seq == inSeq) {
+        // Volley already announced
+        return true;
+    }
+    if (message.type == NET_SHOT && (int)message.seq == inSeq && message.index < inResults.size()) {
+        // Shot already resolved: answer from the cache
+        sendMessage(NET_RESULT, inSeq, message.index, inResults[message.index], 0);
+        return true;
+    }
+    if (message.type == NET_RESULT && (int)message.seq != outSeq) {
+        // Result for a volley that is already complete
+        return true;
+    }
+    return false;
+}
+
+// Return the next message of `type`, taking early arrivals from the inbox first
+bool NetSession::receiveMessage(unsigned int type, NetMessage& message) {
+    size_t i = 0;
+    while (i < inbox.size()) {
+        if (isStale(inbox[i])) {
+            inbox.erase(inbox.begin() + i);
+        } else if (inbox[i].type == type) {
+            message = inbox[i];
+            inbox.erase(inbox.begin() + i);
+            return true;
+        } else {
+            i++;
+        }
+    }
+
+    while (readMessage(message)) {
+        if (handleControl(message) || isStale(message)) continue;
+        if (message.type == type) return true;
+        inbox.push_back(message);   // The peer is already in a later phase
+    }
+    return false;
+}
+
+// Host: the client introduces itself with session id 0 and receives a new id
+bool NetSession::startHost(SOCKET_TYPE listenSock, SOCKET_TYPE clientSock) {
+    isHost = true;
+    listenSocket = listenSock;
+    sock = clientSock;
+
+    // A client that connects and says nothing must not hold the host forever
+    NetMessage hello;
+    Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(handshakeTimeoutMs);
+    if (!readMessage(hello, deadline) || hello.type != NET_HELLO || hello.a != (int)NET_SESSION_MAGIC || hello.index != 0) {
+        return false;
+    }
+    sessionId = ((unsigned int)rand() ^ (unsigned int)time(NULL)) | 1u;
+    established = sendMessage(NET_WELCOME, 0, sessionId, NET_SESSION_MAGIC, 0);
+    return established;
+}
+
+// Client: ask for a new session
+bool NetSession::startClient(const std::string& host, SOCKET_TYPE hostSock, int hostPort) {
+    isHost = false;
+    hostname = host;
+    port = hostPort;
+    sock = hostSock;
+
+    NetMessage welcome;
+    Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(handshakeTimeoutMs);
+    if (!sendMessage(NET_HELLO, 0, 0, NET_SESSION_MAGIC, 0) || !readMessage(welcome, deadline) ||
+        welcome.type != NET_WELCOME || welcome.a != (int)NET_SESSION_MAGIC || welcome.index == 0) {
+        return false;
+    }
+    sessionId = welcome.index;
+    established = true;
+    return true;
+}
+
+// Shooter: remember the volley so it can be re-announced after a resume
+bool NetSession::beginVolley(int seq, int count) {
+    outSeq = seq;
+    outCount = count;
+    return sendMessage(NET_VOLLEY, seq, 0, count, 0);
+}
+
+// Shooter: one shot and its result
+bool NetSession::fireShot(int index, int x, int y, int& result) {
+    TRACE_SCOPE("NetSession::fireShot");
+    if (!sendMessage(NET_SHOT, outSeq, index, x, y)) return false;
+
+    NetMessage message;
+    while (receiveMessage(NET_RESULT, message)) {
+        if ((int)message.index == index) {
+            result = message.a;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Defender: next volley announcement
+bool NetSession::receiveVolley(int& seq, int& count) {
+    TRACE_SCOPE("NetSession::receiveVolley");
+    NetMessage message;
+    if (!receiveMessage(NET_VOLLEY, message)) return false;
+
+    inSeq = message.seq;
+    inCount = message.a;
+    inResults.clear();
+    seq = inSeq;
+    count = inCount;
+    return true;
+}
+
+// Defender: shot `index` of the current volley
+bool NetSession::receiveShot(int index, int& x, int& y) {
+    TRACE_SCOPE("NetSession::receiveShot");
+    NetMessage message;
+    while (receiveMessage(NET_SHOT, message)) {
+        if ((int)message.seq == inSeq && (int)message.index == index) {
+            x = message.a;
+            y = message.b;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Defender: cache first, so the result can be replayed if this send is lost
+void NetSession::answerShot(int result) {
+    inResults.push_back(result);
+    sendMessage(NET_RESULT, inSeq, (int)inResults.size() - 1, result, 0);
+}
+
+// Ping, answer pings and queue whatever has arrived, without blocking
+bool NetSession::heartbeat() {
+    TRACE_SCOPE("NetSession::heartbeat");
+    if (broken || sock == INVALID_SOCKET_VALUE || !checkHeartbeat()) return false;
+
+    NetMessage message;
+    while (true) {
+        fd_set readSet;
+        FD_ZERO(&readSet);
+        FD_SET(sock, &readSet);
+        struct timeval tv;
+        tv.tv_sec = 0;
+        tv.tv_usec = 0;
+        if (select((int)sock + 1, &readSet, nullptr, nullptr, &tv) <= 0) break;
+
+        if (!readMessage(message)) return false;
+        if (handleControl(message) || isStale(message)) continue;
+        inbox.push_back(message);
+    }
+    return !broken;
+}
+
+// Sleep, waking as soon as the peer sends anything
+bool NetSession::idle(int milliseconds) {
+    Clock::time_point until = Clock::now() + std::chrono::milliseconds(milliseconds);
+    while (true) {
+        if (!heartbeat()) return false;
+
+        long long leftUs = std::chrono::duration_cast<std::chrono::microseconds>(until - Clock::now()).count();
+        if (leftUs <= 0) return true;
+        if (leftUs > 50000) leftUs = 50000;    // Wake up for our own pings too
+
+        fd_set readSet;
+        FD_ZERO(&readSet);
+        FD_SET(sock, &readSet);
+        struct timeval tv;
+        tv.tv_sec = 0;
+        tv.tv_usec = (long)leftUs;
+        select((int)sock + 1, &readSet, nullptr, nullptr, &tv);
+    }
+}
+
+// Re-establish the connection and re-announce the volley in progress
+bool NetSession::resume(int turnNumber) {
+    TRACE_SCOPE("NetSession::resume");
+    if (sock != INVALID_SOCKET_VALUE) {
+        ::closesocket(sock);
+        sock = INVALID_SOCKET_VALUE;
+    }
+    broken = false;
+    established = false;
+
+    // No read below waits past this deadline; a silent stray connection also gets only
+    // the handshake timeout, so the real client can still dial in after it
+    NetMessage message;
+    Clock::time_point deadline = Clock::now() + std::chrono::seconds(NET_RESUME_TIMEOUT_SEC);
+    bool connected = false;
+
+    while (!connected && Clock::now() < deadline) {
+        if (isHost) {
+            // Wait for the client to dial in again
+            fd_set readSet;
+            FD_ZERO(&readSet);
+            FD_SET(listenSocket, &readSet);
+            struct timeval tv;
+            tv.tv_sec = 1;
+            tv.tv_usec = 0;
+            if (select((int)listenSocket + 1, &readSet, nullptr, nullptr, &tv) <= 0) continue;
+
+            bool accepted = false;
+            sock = NetworkLogic::acceptClientConnection(listenSocket, accepted);
+            if (!accepted) continue;
+
+            Clock::time_point helloBy = std::min(deadline, Clock::now() + std::chrono::milliseconds(handshakeTimeoutMs));
+            connected = readMessage(message, helloBy) && message.type == NET_HELLO &&
+                        message.a == (int)NET_SESSION_MAGIC && message.index == sessionId &&
+                        sendMessage(NET_WELCOME, turnNumber, sessionId, NET_SESSION_MAGIC, 0);
+        } else {
+            sock = NetworkLogic::createClientSocket(hostname.c_str(), port);
+            if (sock == INVALID_SOCKET_VALUE) {
+                SLEEP_MS(1000);
+                continue;
+            }
+            connected = sendMessage(NET_HELLO, turnNumber, sessionId, NET_SESSION_MAGIC, 0) &&
+                        readMessage(message, deadline) && message.type == NET_WELCOME &&
+                        message.index == sessionId;
+        }
+
+        if (!connected) {
+            // Someone else, or the wrong session: drop it and keep waiting
+            if (sock != INVALID_SOCKET_VALUE) ::closesocket(sock);
+            sock = INVALID_SOCKET_VALUE;
+            broken = false;
+            if (!isHost) return false;
+        }
+    }
+    if (!connected) return false;
+
+    // Both sides must be within one volley of each other to resume
+    int peerTurn = (int)message.seq;
+    if (peerTurn < turnNumber - 1 || peerTurn > turnNumber + 1) {
+        close();
+        return false;
+    }
+
+    // The old connection's ping died with it; probe again before timing the new one.
+    // Both sides are back in the game loop, so the probe gets the normal timeout
+    pingOutstanding = false;
+    peerAnswered = false;
+    probeTimeoutSec = NET_PEER_TIMEOUT_SEC;
+    pingSentAt = Clock::time_point();
+    established = true;
+
+    resumeCount++;
+    if (outSeq == turnNumber) {
+        return sendMessage(NET_VOLLEY, outSeq, 0, outCount, 0);
+    }
+    return true;
+}
+
+// Close the game connection (the listening socket belongs to the caller)
+void NetSession::close() {
+    if (sock != INVALID_SOCKET_VALUE) {
+        ::closesocket(sock);
+        sock = INVALID_SOCKET_VALUE;
+    }
+}
+
+// Summarize the heartbeat samples and byte counters; no copy, no allocation
+NetStats NetSession::getStats() const {
+    NetStats stats;
+    stats.rttSamples = (int)rtt.getCount();
+    stats.rttMinMs = rtt.getMin();
+    stats.rttAvgMs = rtt.getMean();
+    stats.rttP99Ms = rtt.quantile(0.99);
+    stats.bytesSent = bytesSent;
+    stats.bytesReceived = bytesReceived;
+    stats.resumes = resumeCount;
+    return stats;
+}
+
+// Count with a k/M suffix
+void formatCount(unsigned long long count, char* buffer, size_t bufferSize) {
+    if (count < 1000) {
+        snprintf(buffer, bufferSize, "%llu", count);
+    } else if (count < 1000000) {
+        snprintf(buffer, bufferSize, "%.1fk", count / 1000.0);
+    } else {
+        snprintf(buffer, bufferSize, "%.1fM", count / 1000000.0);
+    }
+}
+
+// One-line summary for the status bar
+int formatNetStatus(const NetStats& stats, char* buffer, size_t bufferSize) {
+    char sent[24], received[24];
+    formatCount(stats.bytesSent, sent, sizeof(sent));
+    formatCount(stats.bytesReceived, received, sizeof(received));
+
+    int written;
+    if (stats.rttSamples > 0) {
+        written = snprintf(buffer, bufferSize, "RTT %.1f/%.1f/%.1fms TX %s RX %s",
+                           stats.rttMinMs, stats.rttAvgMs, stats.rttP99Ms, sent, received);
+    } else {
+        written = snprintf(buffer, bufferSize, "RTT --  TX %s RX %s", sent, received);
+    }
+    return written < 0 ? 0 : written;
+}
+
+// Append one JSON object per match
+bool writeNetStatsJson(const NetStats& stats, unsigned int sessionId, const std::string& path) {
+    FILE* file = fopen(path.c_str(), "a");
+    if (!file) return false;
+
+    fprintf(file, "{\"session\":%u,\"rtt_ms\":{\"samples\":%d,\"min\":%.3f,\"avg\":%.3f,\"p99\":%.3f},"
+                  "\"bytes_sent\":%llu,\"bytes_received\":%llu,\"resumes\":%d}\n",
+            sessionId, stats.rttSamples, stats.rttMinMs, stats.rttAvgMs, stats.rttP99Ms,
+            stats.bytesSent, stats.bytesReceived, stats.resumes);
+    fclose(file);
+    return true;
+}
@@ -0,0 +1,173 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: net_session.hpp
+ * Description: Header file for NetSession, the resumable framing layer used by
+ *              networked games. Every message carries the volley sequence number
+ *              (GameState::turnNumber) and the shot index within the volley. The
+ *              defending side caches the results it has sent, so after a dropped
+ *              connection the client reconnects with its session id, the shooter
+ *              re-sends only the shots it has no result for, and those are answered
+ *              from the cache instead of restarting the match.
+ */
+
+#ifndef NET_SESSION_HPP
+#define NET_SESSION_HPP
+
+#include "network_logic.hpp"
+#include "quantile_sketch.hpp"
+#include <chrono>
+#include <deque>
+#include <string>
+#include <vector>
+
+const unsigned int NET_SESSION_MAGIC = 0x53424e53;   // "SBNS"
+const int NET_RESUME_TIMEOUT_SEC = 60;               // How long to wait for the peer to come back
+const int NET_HANDSHAKE_TIMEOUT_SEC = 10;            // How long a new connection may stay silent before HELLO/WELCOME
+const int NET_HEARTBEAT_INTERVAL_MS = 2000;          // Gap between pings
+const int NET_PEER_TIMEOUT_SEC = 15;                 // Unanswered ping older than this = connection lost
+const int NET_SETUP_TIMEOUT_SEC = 300;               // Same for the first ping of a match: the peer may still
+                                                     // be placing ships and only answers from the game loop
+
+// Message types
+enum NetMessageType {
+    NET_HELLO = 1,      // client -> host: index = session id (0 = new), seq = client's turn number
+    NET_WELCOME,        // host -> client: index = session id, seq = host's turn number
+    NET_VOLLEY,         // shooter: volley seq announces a = shot count
+    NET_SHOT,           // shooter: shot `index` of volley seq at (a, b)
+    NET_RESULT,         // defender: a = 0 miss, 1 hit, 2 sunk for shot `index` of volley seq
+    NET_PING,           // either side: heartbeat `index`
+    NET_PONG            // answer to heartbeat `index`
+};
+
+// Fixed-size frame, sent in network byte order
+struct NetMessage {
+    unsigned int type;
+    unsigned int seq;
+    unsigned int index;
+    int a;
+    int b;
+};
+
+// Link telemetry for one match
+struct NetStats {
+    int rttSamples;                     // Answered heartbeats (the first, probing one is not counted)
+    double rttMinMs;
+    double rttAvgMs;
+    double rttP99Ms;                    // Within 1% (QuantileSketch)
+    unsigned long long bytesSent;       // Session frames, both directions
+    unsigned long long bytesReceived;
+    int resumes;
+};
+
+class NetSession {
+public:
+    NetSession();
+    ~NetSession();
+
+    // Host: handshake with a freshly accepted client; keeps listenSocket for reconnects
+    bool startHost(SOCKET_TYPE listenSocket, SOCKET_TYPE clientSocket);
+
+    // Client: handshake over a freshly connected socket; keeps hostname and port for reconnects
+    bool startClient(const std::string& hostname, SOCKET_TYPE hostSocket, int port = PORT);
+
+    // Shooter: announce volley seq with count shots
+    bool beginVolley(int seq, int count);
+
+    // Shooter: send shot index and wait for its result (0 = miss, 1 = hit, 2 = sunk)
+    bool fireShot(int index, int x, int y, int& result);
+
+    // Defender: wait for the next volley announcement
+    bool receiveVolley(int& seq, int& count);
+
+    // Defender: wait for shot index of the current volley
+    bool receiveShot(int index, int& x, int& y);
+
+    // Defender: send (and cache) the result of the shot last received
+    // A failed send is remembered; the shooter re-sends the shot after resume()
+    void answerShot(int result);
+
+    // Keep the link alive while the local player is busy: send a ping when one is
+    // due, answer the peer's pings and take in anything that has arrived.
+    // Returns false if the connection is broken or the peer stopped answering.
+    bool heartbeat();
+
+    // Sleep for `milliseconds` while running heartbeat(), so pings are answered promptly
+    bool idle(int milliseconds);
+
+    // Reconnect after a failure: the client dials the host again, the host waits
+    // for it on the listening socket. Returns false if the peer does not return
+    // within NET_RESUME_TIMEOUT_SEC or presents another session id.
+    bool resume(int turnNumber);
+
+    void close();
+    SOCKET_TYPE getSocket() const { return sock; }
+    unsigned int getSessionId() const { return sessionId; }
+    int getResumeCount() const { return resumeCount; }
+    NetStats getStats() const;
+    void setHeartbeatInterval(int milliseconds) { heartbeatIntervalMs = milliseconds; }
+    void setHandshakeTimeout(int milliseconds) { handshakeTimeoutMs = milliseconds; }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    bool sendMessage(unsigned int type, int seq, int index, int a, int b);
+    // deadline: give up (and mark the link broken) if nothing arrives by then;
+    // only the handshakes need one, later reads rely on the heartbeat timeout
+    bool readMessage(NetMessage& message, Clock::time_point deadline = Clock::time_point::max());
+    bool receiveMessage(unsigned int type, NetMessage& message);
+    bool isStale(const NetMessage& message);
+    bool handleControl(const NetMessage& message);
+    bool checkHeartbeat();
+    bool waitReadable(Clock::time_point deadline);
+
+    SOCKET_TYPE sock;
+    SOCKET_TYPE listenSocket;    // Host only
+    std::string hostname;        // Client only
+    int port;                    // Client only
+    bool isHost;
+    unsigned int sessionId;
+    int resumeCount;
+    bool broken;                 // Last send or receive failed; resume() before retrying
+    int handshakeTimeoutMs;      // Silence allowed from a new connection before HELLO/WELCOME
+
+    // Shooter side: the volley in progress, re-announced after a resume
+    int outSeq;
+    int outCount;
+
+    // Defender side: results already sent for volley inSeq, replayed on request
+    int inSeq;
+    int inCount;
+    std::vector<int> inResults;
+
+    // Messages of a later phase that arrived early (peer already moved on)
+    std::deque<NetMessage> inbox;
+
+    // Heartbeat: at most one ping is outstanding at a time
+    bool established;            // Handshake done; pings may be sent
+    int heartbeatIntervalMs;
+    unsigned int pingId;
+    bool pingOutstanding;
+    bool peerAnswered;           // A ping was answered since the (re)connect
+    int probeTimeoutSec;         // Timeout of the first ping after the (re)connect
+    Clock::time_point pingSentAt;
+    QuantileSketch rtt;          // Answered heartbeats; memory does not grow with match length
+    unsigned long long bytesSent;
+    unsigned long long bytesReceived;
+
+    NetSession(const NetSession&);
+    NetSession& operator=(const NetSession&);
+};
+
+// Count with a k/M suffix, e.g. "3.1k"; also used by the performance overlay
+void formatCount(unsigned long long count, char* buffer, size_t bufferSize);
+
+// One-line summary for the status bar, e.g. "RTT 0.4/0.6/1.9ms TX 3.1k RX 2.9k"
+int formatNetStatus(const NetStats& stats, char* buffer, size_t bufferSize);
+
+// Append the stats as one JSON object per line; returns false if the file cannot be opened
+bool writeNetStatsJson(const NetStats& stats, unsigned int sessionId, const std::string& path);
+
+#endif
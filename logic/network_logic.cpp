@@ -10,7 +10,17 @@
  */
 
 #include "network_logic.hpp"
+#include "../data/trace.hpp"
+#include <chrono>
+#include <cstdio>
 #include <cstring>
+#include <thread>
+
+#ifndef _WIN32
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <sys/select.h>
+#endif
 
 // Initialize networking subsystem (required for Windows)
 bool NetworkLogic::initializeNetworking() {
@@ -29,10 +39,32 @@ void NetworkLogic::cleanupNetworking() {
     #endif
 }
 
-// Create and configure host socket for accepting connections
-SOCKET_TYPE NetworkLogic::createHostSocket() {
+// Set receive timeout (60 seconds) to prevent indefinite blocking
+static void setReceiveTimeout(SOCKET_TYPE socket) {
+    #ifdef _WIN32
+        DWORD timeout = 60000;
+        setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, (const char*)&timeout, sizeof(timeout));
+    #else
+        struct timeval tv;
+        tv.tv_sec = 60;
+        tv.tv_usec = 0;
+        setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, (const char*)&tv, sizeof(tv));
+    #endif
+}
+
+// Whether the last connect() is still in progress rather than failed
+static bool connectPending() {
+    #ifdef _WIN32
+        return WSAGetLastError() == WSAEWOULDBLOCK;
+    #else
+        return errno == EINPROGRESS;
+    #endif
+}
+
+// Create a listening socket for one address family, or INVALID_SOCKET_VALUE
+static SOCKET_TYPE createListener(int family, int port) {
     // Create TCP socket
-    SOCKET_TYPE hostSocket = socket(PF_INET, SOCK_STREAM, 0);
+    SOCKET_TYPE hostSocket = socket(family, SOCK_STREAM, 0);
     if (hostSocket == INVALID_SOCKET_VALUE) {
         return INVALID_SOCKET_VALUE;
     }
@@ -44,15 +76,30 @@ SOCKET_TYPE NetworkLogic::createHostSocket() {
         return INVALID_SOCKET_VALUE;
     }
     
-    // Configure server address structure
-    struct sockaddr_in serverAddress;
+    // Configure server address structure (any interface)
+    struct sockaddr_storage serverAddress;
+    socklen_t addressSize;
     memset(&serverAddress, 0, sizeof(serverAddress));
-    serverAddress.sin_family = AF_INET;
-    serverAddress.sin_addr.s_addr = INADDR_ANY;  // Accept connections on any interface
-    serverAddress.sin_port = htons(PORT);
+    if (family == AF_INET6) {
+        // Accept IPv4 clients on the same socket as IPv4-mapped addresses
+        int off = 0;
+        setsockopt(hostSocket, IPPROTO_IPV6, IPV6_V6ONLY, (const char*)&off, sizeof(off));
+        
+        struct sockaddr_in6* address = (struct sockaddr_in6*)&serverAddress;
+        address->sin6_family = AF_INET6;
+        address->sin6_addr = in6addr_any;
+        address->sin6_port = htons(port);
+        addressSize = sizeof(struct sockaddr_in6);
+    } else {
+        struct sockaddr_in* address = (struct sockaddr_in*)&serverAddress;
+        address->sin_family = AF_INET;
+        address->sin_addr.s_addr = INADDR_ANY;
+        address->sin_port = htons(port);
+        addressSize = sizeof(struct sockaddr_in);
+    }
     
     // Bind socket to address
-    if (bind(hostSocket, (struct sockaddr*)&serverAddress, sizeof(serverAddress)) < 0) {
+    if (bind(hostSocket, (struct sockaddr*)&serverAddress, addressSize) < 0) {
         closesocket(hostSocket);
         return INVALID_SOCKET_VALUE;
     }
@@ -66,9 +113,20 @@ SOCKET_TYPE NetworkLogic::createHostSocket() {
     return hostSocket;
 }
 
+// Create and configure host socket for accepting connections
+SOCKET_TYPE NetworkLogic::createHostSocket(int port) {
+    // Prefer one dual-stack socket; fall back to IPv4 where IPv6 is unavailable
+    SOCKET_TYPE hostSocket = createListener(AF_INET6, port);
+    if (hostSocket == INVALID_SOCKET_VALUE) {
+        hostSocket = createListener(AF_INET, port);
+    }
+    return hostSocket;
+}
+
 // Accept incoming client connection
 SOCKET_TYPE NetworkLogic::acceptClientConnection(SOCKET_TYPE hostSocket, bool& accepted) {
-    struct sockaddr_in clientAddress;
+    TRACE_SCOPE("NetworkLogic::acceptClientConnection");
+    struct sockaddr_storage clientAddress;
     socklen_t addressSize = sizeof(clientAddress);
     
     // Accept connection
@@ -78,73 +136,178 @@ SOCKET_TYPE NetworkLogic::acceptClientConnection(SOCKET_TYPE hostSocket, bool& a
         return INVALID_SOCKET_VALUE;
     }
     
-    // Set receive timeout (60 seconds) to prevent indefinite blocking
-    #ifdef _WIN32
-        DWORD timeout = 60000;
-        setsockopt(clientSocket, SOL_SOCKET, SO_RCVTIMEO, (const char*)&timeout, sizeof(timeout));
-    #else
-        struct timeval tv;
-        tv.tv_sec = 60;
-        tv.tv_usec = 0;
-        setsockopt(clientSocket, SOL_SOCKET, SO_RCVTIMEO, (const char*)&tv, sizeof(tv));
-    #endif
-    
+    setReceiveTimeout(clientSocket);
     accepted = true;
     return clientSocket;
 }
 
 // Create client socket and connect to host
-SOCKET_TYPE NetworkLogic::createClientSocket(const char* hostname) {
-    // Create TCP socket
-    SOCKET_TYPE clientSocket = socket(PF_INET, SOCK_STREAM, 0);
-    if (clientSocket == INVALID_SOCKET_VALUE) {
+SOCKET_TYPE NetworkLogic::createClientSocket(const char* hostname, int port) {
+    std::vector<NetAddress> addresses;
+    if (!resolveAddresses(hostname, port, addresses)) {
         return INVALID_SOCKET_VALUE;
     }
+    return connectFirst(addresses);
+}
+
+// Resolve hostname to all of its addresses
+bool NetworkLogic::resolveAddresses(const char* name, int port, std::vector<NetAddress>& addresses) {
+    TRACE_SCOPE("NetworkLogic::resolveAddresses");
+    addresses.clear();
     
-    // Set receive timeout
-    #ifdef _WIN32
-        DWORD timeout = 60000;
-        setsockopt(clientSocket, SOL_SOCKET, SO_RCVTIMEO, (const char*)&timeout, sizeof(timeout));
-    #else
-        struct timeval tv;
-        tv.tv_sec = 60;
-        tv.tv_usec = 0;
-        setsockopt(clientSocket, SOL_SOCKET, SO_RCVTIMEO, (const char*)&tv, sizeof(tv));
-    #endif
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_ADDRCONFIG;
     
-    // Configure server address
-    struct sockaddr_in serverAddress;
-    memset(&serverAddress, 0, sizeof(serverAddress));
-    serverAddress.sin_family = AF_INET;
-    serverAddress.sin_addr.s_addr = resolveName(hostname);
+    char service[16];
+    snprintf(service, sizeof(service), "%d", port);
     
-    if (serverAddress.sin_addr.s_addr == 0) {
-        closesocket(clientSocket);
-        return INVALID_SOCKET_VALUE;
+    struct addrinfo* results = nullptr;
+    if (getaddrinfo(name, service, &hints, &results) != 0 || !results) {
+        return false;
+    }
+    
+    // Split by family, keeping the resolver's order within each
+    std::vector<NetAddress> byFamily[2];
+    int firstFamily = results->ai_family;
+    for (struct addrinfo* info = results; info; info = info->ai_next) {
+        if (info->ai_family != AF_INET && info->ai_family != AF_INET6) continue;
+        if (info->ai_addrlen > sizeof(struct sockaddr_storage)) continue;
+        
+        NetAddress address;
+        memset(&address.storage, 0, sizeof(address.storage));
+        memcpy(&address.storage, info->ai_addr, info->ai_addrlen);
+        address.length = (socklen_t)info->ai_addrlen;
+        byFamily[info->ai_family == firstFamily ? 0 : 1].push_back(address);
     }
+    freeaddrinfo(results);
     
-    serverAddress.sin_port = htons(PORT);
+    // Alternate families, starting with the resolver's preference, so a dead
+    // family costs at most one attempt delay
+    for (size_t i = 0; i < byFamily[0].size() || i < byFamily[1].size(); i++) {
+        if (i < byFamily[0].size()) addresses.push_back(byFamily[0][i]);
+        if (i < byFamily[1].size()) addresses.push_back(byFamily[1][i]);
+    }
+    return !addresses.empty();
+}
+
+// Resolve on a detached thread so the caller can keep drawing (and give up)
+std::future<std::vector<NetAddress>> NetworkLogic::resolveAsync(const std::string& name, int port) {
+    std::packaged_task<std::vector<NetAddress>()> task([name, port]() {
+        std::vector<NetAddress> addresses;
+        resolveAddresses(name.c_str(), port, addresses);
+        return addresses;
+    });
+    std::future<std::vector<NetAddress>> result = task.get_future();
+    std::thread(std::move(task)).detach();
+    return result;
+}
+
+// Race non-blocking connects to each address; the first to complete wins
+SOCKET_TYPE NetworkLogic::connectFirst(const std::vector<NetAddress>& addresses, int timeoutMs) {
+    TRACE_SCOPE("NetworkLogic::connectFirst");
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeoutMs);
+    Clock::time_point nextAttempt = Clock::now();
+    
+    std::vector<SOCKET_TYPE> pending;
+    SOCKET_TYPE winner = INVALID_SOCKET_VALUE;
+    size_t next = 0;
     
-    // Connect to server
-    if (connect(clientSocket, (const struct sockaddr*)&serverAddress, sizeof(serverAddress)) < 0) {
-        closesocket(clientSocket);
+    while (winner == INVALID_SOCKET_VALUE) {
+        Clock::time_point now = Clock::now();
+        if (now >= deadline) break;
+        
+        // Start the next attempt when the previous one has had its head start
+        if (next < addresses.size() && (pending.empty() || now >= nextAttempt)) {
+            const NetAddress& address = addresses[next++];
+            SOCKET_TYPE sock = socket(address.storage.ss_family, SOCK_STREAM, 0);
+            if (sock == INVALID_SOCKET_VALUE || !setNonBlocking(sock)) {
+                if (sock != INVALID_SOCKET_VALUE) closesocket(sock);
+                continue;
+            }
+            if (connect(sock, (const struct sockaddr*)&address.storage, address.length) == 0) {
+                winner = sock;
+            } else if (connectPending()) {
+                pending.push_back(sock);
+                nextAttempt = now + std::chrono::milliseconds(CONNECT_ATTEMPT_DELAY_MS);
+            } else {
+                closesocket(sock);    // Refused outright: try the next address now
+                nextAttempt = now;
+            }
+            continue;
+        }
+        if (pending.empty()) break;   // Every address failed
+        
+        // Wait until an attempt finishes, the next one is due, or time runs out
+        Clock::time_point wakeUp = deadline;
+        if (next < addresses.size() && nextAttempt < wakeUp) wakeUp = nextAttempt;
+        long long waitUs = std::chrono::duration_cast<std::chrono::microseconds>(wakeUp - now).count();
+        
+        fd_set writeSet, errorSet;
+        FD_ZERO(&writeSet);
+        FD_ZERO(&errorSet);
+        SOCKET_TYPE maxSocket = 0;
+        for (SOCKET_TYPE sock : pending) {
+            FD_SET(sock, &writeSet);
+            FD_SET(sock, &errorSet);
+            if (sock > maxSocket) maxSocket = sock;
+        }
+        struct timeval tv;
+        tv.tv_sec = (long)(waitUs / 1000000);
+        tv.tv_usec = (long)(waitUs % 1000000);
+        if (select((int)maxSocket + 1, nullptr, &writeSet, &errorSet, &tv) <= 0) continue;
+        
+        for (size_t i = 0; i < pending.size() && winner == INVALID_SOCKET_VALUE; ) {
+            SOCKET_TYPE sock = pending[i];
+            if (!FD_ISSET(sock, &writeSet) && !FD_ISSET(sock, &errorSet)) {
+                i++;
+                continue;
+            }
+            int error = 0;
+            socklen_t errorSize = sizeof(error);
+            getsockopt(sock, SOL_SOCKET, SO_ERROR, (char*)&error, &errorSize);
+            pending.erase(pending.begin() + i);
+            if (error == 0) {
+                winner = sock;
+            } else {
+                closesocket(sock);
+                nextAttempt = Clock::now();    // Failed: do not make the next address wait
+            }
+        }
+    }
+    
+    // Close the attempts that lost the race
+    for (SOCKET_TYPE sock : pending) {
+        closesocket(sock);
+    }
+    if (winner == INVALID_SOCKET_VALUE) {
         return INVALID_SOCKET_VALUE;
     }
     
-    return clientSocket;
+    setNonBlocking(winner, false);
+    setReceiveTimeout(winner);
+    return winner;
 }
 
-// Resolve hostname to IP address
-unsigned long NetworkLogic::resolveName(const char* name) {
-    struct hostent* host = gethostbyname(name);
-    if (host == NULL) {
-        return 0;
-    }
-    return *((unsigned long*)host->h_addr_list[0]);
+// Switch a socket between blocking and non-blocking mode
+bool NetworkLogic::setNonBlocking(SOCKET_TYPE socket, bool enabled) {
+    #ifdef _WIN32
+        u_long mode = enabled ? 1 : 0;
+        return ioctlsocket(socket, FIONBIO, &mode) == 0;
+    #else
+        int flags = fcntl(socket, F_GETFL, 0);
+        if (flags < 0) return false;
+        flags = enabled ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+        return fcntl(socket, F_SETFL, flags) == 0;
+    #endif
 }
 
 // Send game settings to opponent
 bool NetworkLogic::sendGameSettings(SOCKET_TYPE socket, int boardSize, int shotsPerTurn) {
+    TRACE_SCOPE("NetworkLogic::sendGameSettings");
     if (send(socket, (const char*)&boardSize, sizeof(int), 0) <= 0) return false;
     if (send(socket, (const char*)&shotsPerTurn, sizeof(int), 0) <= 0) return false;
     return true;
@@ -152,6 +315,7 @@ bool NetworkLogic::sendGameSettings(SOCKET_TYPE socket, int boardSize, int shots
 
 // Receive game settings from opponent
 bool NetworkLogic::receiveGameSettings(SOCKET_TYPE socket, int& boardSize, int& shotsPerTurn) {
+    TRACE_SCOPE("NetworkLogic::receiveGameSettings");
     if (recv(socket, (char*)&boardSize, sizeof(int), MSG_WAITALL) <= 0) return false;
     if (recv(socket, (char*)&shotsPerTurn, sizeof(int), MSG_WAITALL) <= 0) return false;
     return true;
@@ -159,30 +323,36 @@ bool NetworkLogic::receiveGameSettings(SOCKET_TYPE socket, int& boardSize, int&
 
 // Send shot coordinates
 bool NetworkLogic::sendShot(SOCKET_TYPE socket, const coordinates& shot) {
+    TRACE_SCOPE("NetworkLogic::sendShot");
     return send(socket, (const char*)&shot, sizeof(shot), 0) > 0;
 }
 
 // Receive shot coordinates
 bool NetworkLogic::receiveShot(SOCKET_TYPE socket, coordinates& shot) {
+    TRACE_SCOPE("NetworkLogic::receiveShot");
     return recv(socket, (char*)&shot, sizeof(shot), MSG_WAITALL) > 0;
 }
 
 // Send shot result (hit/miss/sunk indicator)
 bool NetworkLogic::sendShotResult(SOCKET_TYPE socket, char result) {
+    TRACE_SCOPE("NetworkLogic::sendShotResult");
     return send(socket, &result, sizeof(char), 0) > 0;
 }
 
 // Receive shot result
 bool NetworkLogic::receiveShotResult(SOCKET_TYPE socket, char& result) {
+    TRACE_SCOPE("NetworkLogic::receiveShotResult");
     return recv(socket, &result, sizeof(char), MSG_WAITALL) > 0;
 }
 
 // Send number of shots in volley
 bool NetworkLogic::sendShotCount(SOCKET_TYPE socket, int count) {
+    TRACE_SCOPE("NetworkLogic::sendShotCount");
     return send(socket, (const char*)&count, sizeof(int), 0) > 0;
 }
 
 // Receive number of shots in opponent's volley
 bool NetworkLogic::receiveShotCount(SOCKET_TYPE socket, int& count) {
+    TRACE_SCOPE("NetworkLogic::receiveShotCount");
     return recv(socket, (char*)&count, sizeof(int), MSG_WAITALL) > 0;
 }
\ No newline at end of file
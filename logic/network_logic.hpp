@@ -33,10 +33,21 @@
 #endif
 
 #include "../data/game_state.hpp"
+#include <future>
 #include <string>
+#include <vector>
 
 #define PORT 12345  // Default port for game connections
 
+const int CONNECT_ATTEMPT_DELAY_MS = 250;   // Head start of each address before the next is tried
+const int CONNECT_TIMEOUT_MS = 10000;       // Give up connecting after this long
+
+// One resolved socket address (IPv4 or IPv6)
+struct NetAddress {
+    struct sockaddr_storage storage;
+    socklen_t length;
+};
+
 class NetworkLogic {
 public:
     // Initialize networking subsystem (Windows WSA startup)
@@ -46,16 +57,29 @@ public:
     static void cleanupNetworking();
     
     // Create and configure socket for hosting a game
-    static SOCKET_TYPE createHostSocket();
+    // Dual-stack (IPv6 socket that also accepts IPv4) where available, IPv4 otherwise
+    static SOCKET_TYPE createHostSocket(int port = PORT);
     
     // Accept incoming client connection on host socket
     static SOCKET_TYPE acceptClientConnection(SOCKET_TYPE hostSocket, bool& accepted);
     
-    // Create socket and connect to host
-    static SOCKET_TYPE createClientSocket(const char* hostname);
+    // Create socket and connect to host (resolves and connects on the calling thread)
+    static SOCKET_TYPE createClientSocket(const char* hostname, int port = PORT);
+    
+    // Resolve hostname to every address it has, IPv6 and IPv4 interleaved
+    // Returns false if the name does not resolve
+    static bool resolveAddresses(const char* name, int port, std::vector<NetAddress>& addresses);
+    
+    // Resolve on a background thread; the future is ready when resolution finishes
+    // (empty list on failure). Dropping the future does not wait for the resolver.
+    static std::future<std::vector<NetAddress>> resolveAsync(const std::string& name, int port);
+    
+    // Connect to the first address that answers: attempts start CONNECT_ATTEMPT_DELAY_MS
+    // apart (sooner if one fails) and race each other, the rest are closed
+    static SOCKET_TYPE connectFirst(const std::vector<NetAddress>& addresses, int timeoutMs = CONNECT_TIMEOUT_MS);
     
-    // Resolve hostname to IP address
-    static unsigned long resolveName(const char* name);
+    // Switch a socket between blocking and non-blocking mode
+    static bool setNonBlocking(SOCKET_TYPE socket, bool enabled = true);
     
     // Send game configuration (board size, shots per turn)
     static bool sendGameSettings(SOCKET_TYPE socket, int boardSize, int shotsPerTurn);
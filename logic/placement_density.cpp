@@ -0,0 +1,209 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: placement_density.cpp
+ * Description: Implementation of the placement-density kernel. One template holds
+ *              the algorithm; the lane types below supply the row-parallel operations
+ *              for AVX2 (built with -mavx2), SSE2 (any x86-64 build) and plain C++.
+ */
+
+#include "placement_density.hpp"
+#include <cstring>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define DENSITY_HAVE_SSE2 1
+#endif
+
+namespace {
+
+// Rows are stored with PAD empty rows on each side so shifted loads never leave the array
+const int PAD = 32;
+const int ROWS = DENSITY_MAX_BOARD;
+const int SPAN = PAD + ROWS + PAD;
+
+// One row per step
+struct ScalarLanes {
+    typedef unsigned int Vec;
+    static const int WIDTH = 1;
+    static Vec load(const unsigned int* p) { return *p; }
+    static void store(unsigned int* p, Vec v) { *p = v; }
+    static Vec splat(unsigned int x) { return x; }
+    static Vec andv(Vec a, Vec b) { return a & b; }
+    static Vec xorv(Vec a, Vec b) { return a ^ b; }
+    static Vec orv(Vec a, Vec b) { return a | b; }
+    static bool any(Vec a) { return a != 0; }
+    static Vec shl(Vec a, int k) { return a << k; }
+    static Vec shr(Vec a, int k) { return a >> k; }
+};
+
+#ifdef DENSITY_HAVE_SSE2
+// Four rows per step
+struct SSE2Lanes {
+    typedef __m128i Vec;
+    static const int WIDTH = 4;
+    static Vec load(const unsigned int* p) { return _mm_loadu_si128((const __m128i*)p); }
+    static void store(unsigned int* p, Vec v) { _mm_storeu_si128((__m128i*)p, v); }
+    static Vec splat(unsigned int x) { return _mm_set1_epi32((int)x); }
+    static Vec andv(Vec a, Vec b) { return _mm_and_si128(a, b); }
+    static Vec xorv(Vec a, Vec b) { return _mm_xor_si128(a, b); }
+    static Vec orv(Vec a, Vec b) { return _mm_or_si128(a, b); }
+    static bool any(Vec a) { return _mm_movemask_epi8(_mm_cmpeq_epi32(a, _mm_setzero_si128())) != 0xffff; }
+    static Vec shl(Vec a, int k) { return _mm_sll_epi32(a, _mm_cvtsi32_si128(k)); }
+    static Vec shr(Vec a, int k) { return _mm_srl_epi32(a, _mm_cvtsi32_si128(k)); }
+};
+#endif
+
+#if defined(__AVX2__)
+// Eight rows per step
+struct AVX2Lanes {
+    typedef __m256i Vec;
+    static const int WIDTH = 8;
+    static Vec load(const unsigned int* p) { return _mm256_loadu_si256((const __m256i*)p); }
+    static void store(unsigned int* p, Vec v) { _mm256_storeu_si256((__m256i*)p, v); }
+    static Vec splat(unsigned int x) { return _mm256_set1_epi32((int)x); }
+    static Vec andv(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+    static Vec xorv(Vec a, Vec b) { return _mm256_xor_si256(a, b); }
+    static Vec orv(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+    static bool any(Vec a) { return !_mm256_testz_si256(a, a); }
+    static Vec shl(Vec a, int k) { return _mm256_sll_epi32(a, _mm_cvtsi32_si128(k)); }
+    static Vec shr(Vec a, int k) { return _mm256_srl_epi32(a, _mm_cvtsi32_si128(k)); }
+};
+#endif
+
+// Per-cell counters as bit planes: bit x of planes[p][PAD + y] is bit p of the count at (x, y)
+struct Counters {
+    unsigned int planes[DENSITY_PLANES][SPAN];
+};
+
+// Add 1 to every cell whose bit is set in `mask` (rows r..r+WIDTH-1): ripple-carry across planes
+// A carry out of the top plane means the count wrapped to 0; those cells are set back to
+// the maximum, so counts saturate at DENSITY_MAX_COUNT
+template <class L>
+inline void addMask(Counters& counters, int row, typename L::Vec mask) {
+    typename L::Vec carry = mask;
+    for (int p = 0; p < DENSITY_PLANES; p++) {
+        unsigned int* plane = counters.planes[p] + PAD + row;
+        typename L::Vec current = L::load(plane);
+        L::store(plane, L::xorv(current, carry));
+        carry = L::andv(current, carry);
+    }
+    if (!L::any(carry)) return;
+    for (int p = 0; p < DENSITY_PLANES; p++) {
+        unsigned int* plane = counters.planes[p] + PAD + row;
+        L::store(plane, L::orv(L::load(plane), carry));
+    }
+}
+
+template <class L>
+void densityKernel(const unsigned int* blockedRows, int boardSize, const std::vector<int>& shipCounts,
+                   std::vector<unsigned short>& density) {
+    const unsigned int rowMask = boardSize >= 32 ? 0xffffffffu : ((1u << boardSize) - 1);
+
+    // Free cells per row, zero outside the board
+    unsigned int freeRows[SPAN];
+    memset(freeRows, 0, sizeof(freeRows));
+    for (int y = 0; y < boardSize; y++) {
+        freeRows[PAD + y] = ~blockedRows[y] & rowMask;
+    }
+
+    Counters counters;
+    memset(&counters, 0, sizeof(counters));
+    unsigned int starts[SPAN];
+
+    int maxLength = (int)shipCounts.size() - 1;
+    if (maxLength > boardSize) maxLength = boardSize;
+    for (int length = 1; length <= maxLength; length++) {
+        int count = shipCounts[length];
+        if (count <= 0) continue;
+
+        // Horizontal: bit x set if cells x..x+length-1 of the row are free
+        int startBits = boardSize - length + 1;
+        typename L::Vec startLimit = L::splat(startBits >= 32 ? 0xffffffffu : ((1u << startBits) - 1));
+        for (int y = 0; y < boardSize; y += L::WIDTH) {
+            typename L::Vec freeCells = L::load(freeRows + PAD + y);
+            typename L::Vec fits = freeCells;
+            for (int k = 1; k < length; k++) {
+                fits = L::andv(fits, L::shr(freeCells, k));
+            }
+            fits = L::andv(fits, startLimit);
+            for (int k = 0; k < length; k++) {
+                typename L::Vec covered = L::shl(fits, k);
+                for (int c = 0; c < count; c++) addMask<L>(counters, y, covered);
+            }
+        }
+
+        // A one-cell ship has a single placement, already counted
+        if (length == 1) continue;
+
+        // Vertical: bit x of starts[y] set if rows y..y+length-1 are free in column x
+        memset(starts, 0, sizeof(starts));
+        for (int y = 0; y < boardSize; y += L::WIDTH) {
+            typename L::Vec fits = L::load(freeRows + PAD + y);
+            for (int k = 1; k < length; k++) {
+                fits = L::andv(fits, L::load(freeRows + PAD + y + k));
+            }
+            L::store(starts + PAD + y, fits);
+        }
+        for (int y = 0; y < boardSize; y += L::WIDTH) {
+            for (int k = 0; k < length; k++) {
+                typename L::Vec covered = L::load(starts + PAD + y - k);
+                for (int c = 0; c < count; c++) addMask<L>(counters, y, covered);
+            }
+        }
+    }
+
+    // Rows past the board were processed with the lanes but hold nothing
+    density.assign(boardSize * boardSize, 0);
+    for (int y = 0; y < boardSize; y++) {
+        for (int p = 0; p < DENSITY_PLANES; p++) {
+            unsigned int bits = counters.planes[p][PAD + y];
+            for (int x = 0; bits && x < boardSize; x++, bits >>= 1) {
+                if (bits & 1) density[y * boardSize + x] |= (unsigned short)(1u << p);
+            }
+        }
+    }
+}
+
+} // namespace
+
+// Widest instruction set this build was compiled for
+bool computePlacementDensity(const unsigned int* blockedRows, int boardSize,
+                             const std::vector<int>& shipCounts, std::vector<unsigned short>& density) {
+    density.clear();
+    if (boardSize <= 0 || boardSize > DENSITY_MAX_BOARD) return false;
+
+    #if defined(__AVX2__)
+        densityKernel<AVX2Lanes>(blockedRows, boardSize, shipCounts, density);
+    #elif defined(DENSITY_HAVE_SSE2)
+        densityKernel<SSE2Lanes>(blockedRows, boardSize, shipCounts, density);
+    #else
+        densityKernel<ScalarLanes>(blockedRows, boardSize, shipCounts, density);
+    #endif
+    return true;
+}
+
+// Portable version, one row per step
+bool computePlacementDensityScalar(const unsigned int* blockedRows, int boardSize,
+                                   const std::vector<int>& shipCounts, std::vector<unsigned short>& density) {
+    density.clear();
+    if (boardSize <= 0 || boardSize > DENSITY_MAX_BOARD) return false;
+
+    densityKernel<ScalarLanes>(blockedRows, boardSize, shipCounts, density);
+    return true;
+}
+
+const char* placementDensityKernel() {
+    #if defined(__AVX2__)
+        return "AVX2";
+    #elif defined(DENSITY_HAVE_SSE2)
+        return "SSE2";
+    #else
+        return "scalar";
+    #endif
+}
@@ -0,0 +1,40 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: placement_density.hpp
+ * Description: Header file for the placement-density kernel. For every cell it counts
+ *              how many placements of the remaining ships cover it, given the cells
+ *              that can no longer hold a ship (misses and sunk ships). Each board row
+ *              is a 32-bit mask; run-length fits come from AND-ing shifted masks, and
+ *              the per-cell counts are kept as bit planes, so the whole kernel is
+ *              AND/XOR/shift over many rows at once: 8 rows per step with AVX2,
+ *              4 with SSE2, 1 in the portable scalar version.
+ */
+
+#ifndef PLACEMENT_DENSITY_HPP
+#define PLACEMENT_DENSITY_HPP
+
+#include <vector>
+
+const int DENSITY_MAX_BOARD = 32;   // One row per 32-bit lane
+const int DENSITY_PLANES = 12;      // Bit planes per count
+const int DENSITY_MAX_COUNT = (1 << DENSITY_PLANES) - 1;   // Counts saturate here (large custom fleets)
+
+// Count placements covering each cell
+// blockedRows: bit x of blockedRows[y] set if (x, y) cannot be part of a ship
+// shipCounts: shipCounts[length] = remaining ships of that length, for length 1..maxLength
+// density: receives boardSize * boardSize counts, row-major
+// Returns false (and leaves density empty) if boardSize exceeds DENSITY_MAX_BOARD
+bool computePlacementDensity(const unsigned int* blockedRows, int boardSize,
+                             const std::vector<int>& shipCounts, std::vector<unsigned short>& density);
+
+// Same result from the portable one-row-at-a-time version (for checking the vector paths)
+bool computePlacementDensityScalar(const unsigned int* blockedRows, int boardSize,
+                                   const std::vector<int>& shipCounts, std::vector<unsigned short>& density);
+
+// Instruction set used by computePlacementDensity: "AVX2", "SSE2" or "scalar"
+const char* placementDensityKernel();
+
+#endif
@@ -0,0 +1,143 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: quantile_sketch.cpp
+ * Description: Implementation of the DDSketch quantile estimator.
+ */
+
+#include "quantile_sketch.hpp"
+#include <cmath>
+
+// Values below this are counted as zero (log buckets cannot reach 0)
+static const double SKETCH_MIN_VALUE = 1e-9;
+
+QuantileSketch::QuantileSketch(double relativeAccuracy)
+    : accuracy(relativeAccuracy), offset(0), zeroCount(0), count(0), sum(0.0), minValue(0.0), maxValue(0.0) {
+    if (accuracy <= 0.0 || accuracy >= 1.0) accuracy = SKETCH_DEFAULT_ACCURACY;
+    gamma = (1.0 + accuracy) / (1.0 - accuracy);
+    logGamma = std::log(gamma);
+}
+
+// Bucket key: the value lies in (gamma^(key-1), gamma^key]
+int QuantileSketch::keyOf(double value) const {
+    return (int)std::ceil(std::log(value) / logGamma);
+}
+
+// Grow the bucket range to cover key; past SKETCH_MAX_BUCKETS the lowest keys are folded
+// into the lowest kept one, so only the low quantiles lose accuracy
+void QuantileSketch::addToKey(int key, long long n) {
+    if (buckets.empty()) {
+        offset = key;
+        buckets.push_back(0);
+    }
+    if (key < offset) {
+        int grow = offset - key;
+        if ((int)buckets.size() + grow > SKETCH_MAX_BUCKETS) {
+            grow = SKETCH_MAX_BUCKETS - (int)buckets.size();
+            if (grow <= 0) {
+                buckets[0] += n;
+                return;
+            }
+            key = offset - grow;
+        }
+        buckets.insert(buckets.begin(), grow, 0);
+        offset -= grow;
+    } else if (key >= offset + (int)buckets.size()) {
+        int size = key - offset + 1;
+        if (size > SKETCH_MAX_BUCKETS) {
+            // Fold every key up to the new lowest one into it to make room at the top
+            int newOffset = key - SKETCH_MAX_BUCKETS + 1;
+            std::vector<long long> kept(SKETCH_MAX_BUCKETS, 0);
+            for (size_t i = 0; i < buckets.size(); i++) {
+                int old = offset + (int)i;
+                kept[old > newOffset ? old - newOffset : 0] += buckets[i];
+            }
+            buckets.swap(kept);
+            offset = newOffset;
+        } else {
+            buckets.resize(size, 0);
+        }
+    }
+    buckets[key - offset] += n;
+}
+
+void QuantileSketch::add(double value) {
+    if (value < 0.0) value = 0.0;
+    if (count == 0 || value < minValue) minValue = value;
+    if (count == 0 || value > maxValue) maxValue = value;
+    count++;
+    sum += value;
+
+    if (value < SKETCH_MIN_VALUE) {
+        zeroCount++;
+    } else {
+        addToKey(keyOf(value), 1);
+    }
+}
+
+bool QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.accuracy != accuracy) return false;
+    if (other.count == 0) return true;
+
+    for (size_t i = 0; i < other.buckets.size(); i++) {
+        if (other.buckets[i]) addToKey(other.offset + (int)i, other.buckets[i]);
+    }
+    if (count == 0 || other.minValue < minValue) minValue = other.minValue;
+    if (count == 0 || other.maxValue > maxValue) maxValue = other.maxValue;
+    zeroCount += other.zeroCount;
+    count += other.count;
+    sum += other.sum;
+    return true;
+}
+
+// Walk the buckets to the rank of q; the bucket's midpoint (in relative terms) is
+// within `accuracy` of every value in it
+double QuantileSketch::quantile(double q) const {
+    if (count == 0) return 0.0;
+    if (q <= 0.0) return minValue;
+    if (q >= 1.0) return maxValue;
+
+    long long rank = (long long)(q * (count - 1));
+    if (rank < zeroCount) return 0.0;
+    long long seen = zeroCount;
+    for (size_t i = 0; i < buckets.size(); i++) {
+        seen += buckets[i];
+        if (seen > rank) {
+            double estimate = 2.0 * std::pow(gamma, offset + (int)i) / (gamma + 1.0);
+            if (estimate < minValue) estimate = minValue;
+            if (estimate > maxValue) estimate = maxValue;
+            return estimate;
+        }
+    }
+    return maxValue;
+}
+
+int QuantileSketch::getBucketCount() const {
+    return (int)buckets.size() + (zeroCount ? 1 : 0);
+}
+
+double QuantileSketch::getBucketLower(int i) const {
+    if (zeroCount) {
+        if (i == 0) return 0.0;
+        i--;
+    }
+    return std::pow(gamma, offset + i - 1);
+}
+
+double QuantileSketch::getBucketUpper(int i) const {
+    if (zeroCount) {
+        if (i == 0) return 0.0;
+        i--;
+    }
+    return std::pow(gamma, offset + i);
+}
+
+long long QuantileSketch::getBucketValues(int i) const {
+    if (zeroCount) {
+        if (i == 0) return zeroCount;
+        i--;
+    }
+    return buckets[i];
+}
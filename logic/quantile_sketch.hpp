@@ -0,0 +1,64 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: quantile_sketch.hpp
+ * Description: Header file for QuantileSketch, a DDSketch streaming quantile
+ *              estimator. Values fall into logarithmic buckets, so every quantile
+ *              is returned within a fixed relative error and memory depends only on
+ *              the range of the values, not on how many were added. Sketches with
+ *              the same accuracy merge exactly by adding bucket counts.
+ */
+
+#ifndef QUANTILE_SKETCH_HPP
+#define QUANTILE_SKETCH_HPP
+
+#include <vector>
+
+const double SKETCH_DEFAULT_ACCURACY = 0.01;    // Quantiles within 1% of the true value
+const int SKETCH_MAX_BUCKETS = 2048;            // Lowest buckets are folded together past this
+
+class QuantileSketch {
+public:
+    explicit QuantileSketch(double relativeAccuracy = SKETCH_DEFAULT_ACCURACY);
+
+    // Add a non-negative value (negative values count as 0)
+    void add(double value);
+
+    // Add every value of other (same accuracy); returns false if the accuracies differ
+    bool merge(const QuantileSketch& other);
+
+    // Value at quantile q (0 = min, 1 = max); 0 for an empty sketch
+    double quantile(double q) const;
+
+    long long getCount() const { return count; }
+    double getMin() const { return count ? minValue : 0.0; }
+    double getMax() const { return count ? maxValue : 0.0; }
+    double getMean() const { return count ? sum / count : 0.0; }
+    double getAccuracy() const { return accuracy; }
+
+    // Histogram view: bucket i holds values in (getBucketLower(i), getBucketUpper(i)]
+    // (the zero bucket, when used, is bucket 0 and holds exactly 0)
+    int getBucketCount() const;
+    double getBucketLower(int i) const;
+    double getBucketUpper(int i) const;
+    long long getBucketValues(int i) const;
+
+private:
+    double accuracy;
+    double gamma;                   // (1 + accuracy) / (1 - accuracy)
+    double logGamma;
+    int offset;                     // Key of buckets[0]
+    std::vector<long long> buckets; // Counts for keys offset .. offset + size - 1
+    long long zeroCount;
+    long long count;
+    double sum;
+    double minValue;
+    double maxValue;
+
+    int keyOf(double value) const;
+    void addToKey(int key, long long n);
+};
+
+#endif
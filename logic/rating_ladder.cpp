@@ -0,0 +1,129 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: rating_ladder.cpp
+ * Description: Implementation of the Glicko-1 rating ladder.
+ */
+
+#include "rating_ladder.hpp"
+#include <cmath>
+
+static const double GLICKO_Q = 0.0057564627324851142;     // ln(10) / 400
+static const double GLICKO_PI = 3.14159265358979323846;
+
+// Weight of a result against an opponent with deviation rd
+static double glickoG(double rd) {
+    return 1.0 / std::sqrt(1.0 + 3.0 * GLICKO_Q * GLICKO_Q * rd * rd / (GLICKO_PI * GLICKO_PI));
+}
+
+// Expected score of rating r against (opponent, opponentRd)
+static double glickoE(double r, double opponent, double opponentRd) {
+    return 1.0 / (1.0 + std::pow(10.0, -glickoG(opponentRd) * (r - opponent) / 400.0));
+}
+
+RatingShard::RatingShard(int count)
+    : players(count), games(0), pairGames(count * count, 0), pairScore(count * count, 0.0) {
+}
+
+// Stored once per unordered pair, from the lower id's side
+void RatingShard::recordGame(int a, int b, double scoreA) {
+    if (a == b || a < 0 || b < 0 || a >= players || b >= players) return;
+    if (a > b) {
+        int swap = a;
+        a = b;
+        b = swap;
+        scoreA = 1.0 - scoreA;
+    }
+    pairGames[a * players + b]++;
+    pairScore[a * players + b] += scoreA;
+    games++;
+}
+
+void RatingShard::merge(const RatingShard& other) {
+    if (other.players != players) return;
+    for (size_t i = 0; i < pairGames.size(); i++) {
+        pairGames[i] += other.pairGames[i];
+        pairScore[i] += other.pairScore[i];
+    }
+    games += other.games;
+}
+
+void RatingShard::clear() {
+    pairGames.assign(pairGames.size(), 0);
+    pairScore.assign(pairScore.size(), 0.0);
+    games = 0;
+}
+
+RatingLadder::RatingLadder(double drift)
+    : pending(0), rdDrift(drift), periods(0) {
+}
+
+int RatingLadder::addPlayer(const std::string& name, double rating, double rd) {
+    if (pending.getGames() > 0) return -1;
+
+    PlayerRating player;
+    player.name = name;
+    player.rating = rating;
+    player.rd = rd;
+    player.games = 0;
+    player.score = 0.0;
+    players.push_back(player);
+    pending = RatingShard((int)players.size());
+    return (int)players.size() - 1;
+}
+
+void RatingLadder::merge(const RatingShard& shard) {
+    pending.merge(shard);
+}
+
+// Glicko-1 update of every player against the ratings at the start of the period
+void RatingLadder::endPeriod() {
+    int count = (int)players.size();
+    std::vector<double> variance(count, 0.0);      // Sum of n g^2 E (1 - E)
+    std::vector<double> surprise(count, 0.0);      // Sum of g (s - n E)
+
+    for (int a = 0; a < count; a++) {
+        for (int b = a + 1; b < count; b++) {
+            long long n = pending.pairGames[a * count + b];
+            if (n == 0) continue;
+            double scoreA = pending.pairScore[a * count + b];
+            const PlayerRating& pa = players[a];
+            const PlayerRating& pb = players[b];
+
+            double gb = glickoG(pb.rd), ea = glickoE(pa.rating, pb.rating, pb.rd);
+            variance[a] += n * gb * gb * ea * (1.0 - ea);
+            surprise[a] += gb * (scoreA - n * ea);
+
+            double ga = glickoG(pa.rd), eb = glickoE(pb.rating, pa.rating, pa.rd);
+            variance[b] += n * ga * ga * eb * (1.0 - eb);
+            surprise[b] += ga * ((n - scoreA) - n * eb);
+
+            players[a].games += n;
+            players[b].games += n;
+            players[a].score += scoreA;
+            players[b].score += n - scoreA;
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        PlayerRating& player = players[i];
+        double rd = std::sqrt(player.rd * player.rd + rdDrift * rdDrift);
+        if (rd > GLICKO_INITIAL_RD) rd = GLICKO_INITIAL_RD;
+
+        // 1/RD'^2 = 1/RD^2 + 1/d^2, with 1/d^2 = q^2 * variance
+        double precision = 1.0 / (rd * rd) + GLICKO_Q * GLICKO_Q * variance[i];
+        player.rating += GLICKO_Q / precision * surprise[i];
+        player.rd = std::sqrt(1.0 / precision);
+    }
+
+    pending.clear();
+    periods++;
+}
+
+double RatingLadder::expectedScore(int a, int b) const {
+    const PlayerRating& pa = players[a];
+    const PlayerRating& pb = players[b];
+    return glickoE(pa.rating, pb.rating, std::sqrt(pa.rd * pa.rd + pb.rd * pb.rd));
+}
@@ -0,0 +1,90 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: rating_ladder.hpp
+ * Description: Header file for the Glicko-1 rating ladder used to compare AI
+ *              configurations over large simulated tournaments. Game results are
+ *              collected in RatingShards (one per worker thread, no locking) and
+ *              merged into the ladder; each rating period then updates every player
+ *              from the merged totals. Within a period only per-pair game counts and
+ *              scores are kept, so memory does not grow with the number of games.
+ */
+
+#ifndef RATING_LADDER_HPP
+#define RATING_LADDER_HPP
+
+#include <string>
+#include <vector>
+
+const double GLICKO_INITIAL_RATING = 1500.0;
+const double GLICKO_INITIAL_RD = 350.0;        // Rating deviation of a new player (also the cap)
+const double GLICKO_INTERVAL_Z = 1.96;         // 95% confidence interval = rating +- Z * RD
+
+struct PlayerRating {
+    std::string name;
+    double rating;
+    double rd;                  // Rating deviation
+    long long games;
+    double score;               // Points scored (win 1, draw 0.5)
+};
+
+// Results of one rating period for a fixed set of players
+class RatingShard {
+public:
+    explicit RatingShard(int players);
+
+    // scoreA: 1 = a won, 0 = b won, 0.5 = draw
+    void recordGame(int a, int b, double scoreA);
+
+    // Add another shard's results to this one
+    void merge(const RatingShard& other);
+
+    void clear();
+    int getPlayers() const { return players; }
+    long long getGames() const { return games; }
+
+private:
+    friend class RatingLadder;
+
+    int players;
+    long long games;
+    std::vector<long long> pairGames;   // Games between a and b at [a * players + b], a < b
+    std::vector<double> pairScore;      // Points a scored against b, same layout
+};
+
+class RatingLadder {
+public:
+    // rdDrift: RD added back each period (0 for players that never change)
+    explicit RatingLadder(double rdDrift = 0.0);
+
+    // Add a player, new or carried over from an earlier ladder; returns its id
+    // (-1 while a period has results pending)
+    int addPlayer(const std::string& name, double rating = GLICKO_INITIAL_RATING,
+                  double rd = GLICKO_INITIAL_RD);
+
+    // Empty shard sized for the current players
+    RatingShard newShard() const { return RatingShard((int)players.size()); }
+
+    // Add a shard's results to the current period
+    void merge(const RatingShard& shard);
+
+    // Rate every player from the period's results (Glicko-1) and start a new period
+    void endPeriod();
+
+    int getPlayerCount() const { return (int)players.size(); }
+    const PlayerRating& getPlayer(int id) const { return players[id]; }
+    int getPeriods() const { return periods; }
+
+    // Expected score of a against b from the current ratings
+    double expectedScore(int a, int b) const;
+
+private:
+    std::vector<PlayerRating> players;
+    RatingShard pending;
+    double rdDrift;
+    int periods;
+};
+
+#endif
@@ -0,0 +1,135 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: replay_log.cpp
+ * Description: Implementation of the replay log writer and parser.
+ */
+
+#include "replay_log.hpp"
+
+// Line tags indexed by GameEventType
+static const char REPLAY_TAGS[] = { 'V', 'M', 'H', 'S', 'C', 'E', 'G' };
+static const int REPLAY_TAG_COUNT = sizeof(REPLAY_TAGS) / sizeof(REPLAY_TAGS[0]);
+
+ReplayLogger::ReplayLogger() : file(nullptr) {
+}
+
+ReplayLogger::~ReplayLogger() {
+    close();
+}
+
+// Open (append to) the log file; every game starts with its header, so logs of
+// several board sizes can share one file
+bool ReplayLogger::open(const std::string& path, int boardSize, int shotsPerTurn) {
+    close();
+    file = fopen(path.c_str(), "a");
+    if (!file) return false;
+
+    char header[32];
+    formatReplayHeader(boardSize, shotsPerTurn, header, sizeof(header));
+    fputs(header, file);
+    fputc('\n', file);
+    return true;
+}
+
+// Flush and close the log file
+void ReplayLogger::close() {
+    if (file) {
+        fclose(file);
+        file = nullptr;
+    }
+}
+
+// Append one line per event
+void ReplayLogger::onEvent(const GameEvent& event) {
+    if (!file) return;
+
+    char line[64];
+    if (formatReplayLine(event, line, sizeof(line)) > 0) {
+        fputs(line, file);
+        fputc('\n', file);
+    }
+    if (event.type == EVENT_GAME_OVER || event.type == EVENT_VOLLEY_END) {
+        fflush(file);
+    }
+}
+
+// Write the log line for one event
+int formatReplayLine(const GameEvent& event, char* buffer, size_t bufferSize) {
+    if (event.type >= REPLAY_TAG_COUNT) return 0;
+
+    char tag = REPLAY_TAGS[event.type];
+    int written;
+    switch (event.type) {
+        case EVENT_VOLLEY_BEGIN:
+        case EVENT_VOLLEY_END:
+            written = snprintf(buffer, bufferSize, "%c %d %d %d", tag, event.turn, event.side, event.value);
+            break;
+        case EVENT_SUNK:
+            written = snprintf(buffer, bufferSize, "%c %d %d %d %d %d", tag, event.turn, event.side,
+                               event.x, event.y, event.value);
+            break;
+        case EVENT_GAME_OVER:
+            written = snprintf(buffer, bufferSize, "%c %d %d", tag, event.turn, event.value);
+            break;
+        default:
+            written = snprintf(buffer, bufferSize, "%c %d %d %d %d", tag, event.turn, event.side,
+                               event.x, event.y);
+            break;
+    }
+    return written < 0 ? 0 : written;
+}
+
+// Write the game header line
+int formatReplayHeader(int boardSize, int shotsPerTurn, char* buffer, size_t bufferSize) {
+    int written = snprintf(buffer, bufferSize, "B %d %d", boardSize, shotsPerTurn);
+    return written < 0 ? 0 : written;
+}
+
+// Parse a game header line
+bool parseReplayHeader(const char* line, int& boardSize, int& shotsPerTurn) {
+    return sscanf(line, "B %d %d", &boardSize, &shotsPerTurn) == 2;
+}
+
+// Parse one log line back into an event
+bool parseReplayLine(const char* line, GameEvent& event) {
+    int type = -1;
+    for (int i = 0; i < REPLAY_TAG_COUNT; i++) {
+        if (line[0] == REPLAY_TAGS[i]) type = i;
+    }
+    if (type < 0 || line[1] != ' ') return false;
+
+    int turn = 0, side = 0, x = -1, y = -1, value = 0;
+    int fields;
+    switch (type) {
+        case EVENT_VOLLEY_BEGIN:
+        case EVENT_VOLLEY_END:
+            fields = sscanf(line + 2, "%d %d %d", &turn, &side, &value);
+            if (fields != 3) return false;
+            break;
+        case EVENT_SUNK:
+            fields = sscanf(line + 2, "%d %d %d %d %d", &turn, &side, &x, &y, &value);
+            if (fields != 5) return false;
+            break;
+        case EVENT_GAME_OVER:
+            fields = sscanf(line + 2, "%d %d", &turn, &value);
+            if (fields != 2) return false;
+            side = value;
+            break;
+        default:
+            fields = sscanf(line + 2, "%d %d %d %d", &turn, &side, &x, &y);
+            if (fields != 4) return false;
+            break;
+    }
+    if (side != PLAYER_SIDE && side != ENEMY_SIDE) return false;
+
+    event.type = (unsigned char)type;
+    event.side = (unsigned char)side;
+    event.x = (short)x;
+    event.y = (short)y;
+    event.value = (short)value;
+    event.turn = turn;
+    return true;
+}
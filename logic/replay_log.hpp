@@ -0,0 +1,60 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: replay_log.hpp
+ * Description: Header file for the replay log, a text form of the game event stream.
+ *              ReplayLogger is a GameEventConsumer that appends one line per event;
+ *              parseReplayLine turns a line back into a GameEvent.
+ *
+ * Line format (fields separated by single spaces):
+ *   B <size> <shots>               game header: board size and shots per turn
+ *   V <turn> <side> <shots>        volley begin
+ *   M <turn> <side> <x> <y>        miss
+ *   H <turn> <side> <x> <y>        hit
+ *   S <turn> <side> <x> <y> <n>    sunk, followed by n C lines
+ *   C <turn> <side> <x> <y>        cell of the sunk ship
+ *   E <turn> <side> <wounded>      volley end
+ *   G <turn> <winner>              game over
+ */
+
+#ifndef REPLAY_LOG_HPP
+#define REPLAY_LOG_HPP
+
+#include "game_events.hpp"
+#include <cstdio>
+#include <string>
+
+class ReplayLogger : public GameEventConsumer {
+public:
+    ReplayLogger();
+    ~ReplayLogger();
+
+    // Open (append to) the log file and write the game header;
+    // returns false if it cannot be opened
+    bool open(const std::string& path, int boardSize, int shotsPerTurn);
+    void close();
+    bool isOpen() const { return file != nullptr; }
+
+    void onEvent(const GameEvent& event);
+
+private:
+    FILE* file;
+
+    ReplayLogger(const ReplayLogger&);
+    ReplayLogger& operator=(const ReplayLogger&);
+};
+
+// Write the log line for event into buffer (NUL-terminated, no newline)
+// Returns the number of characters written
+int formatReplayLine(const GameEvent& event, char* buffer, size_t bufferSize);
+
+// Parse one log line; returns false for malformed lines
+bool parseReplayLine(const char* line, GameEvent& event);
+
+// Game header line "B <size> <shots>" (no newline), shared with the spectator stream
+int formatReplayHeader(int boardSize, int shotsPerTurn, char* buffer, size_t bufferSize);
+bool parseReplayHeader(const char* line, int& boardSize, int& shotsPerTurn);
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: shot_history.cpp
+ * Description: Implementation of the opponent shot history and its file format.
+ */
+
+#include "shot_history.hpp"
+#include <cstdio>
+#include <cstring>
+
+static const char HISTORY_MAGIC[4] = { 'S', 'B', 'H', 'M' };
+static const unsigned int HISTORY_VERSION = 1;
+static const int HISTORY_MAX_WEIGHT = 16;      // Weight of a game's first shot; the last one weighs 1
+
+ShotHistory::ShotHistory(int size)
+    : boardSize(size), games(0), shotsThisGame(0), heat(size * size, 0) {
+}
+
+// Read the header and every section, keeping ours and setting the rest aside
+bool ShotHistory::load(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) return true;
+
+    char magic[4];
+    unsigned int header[2];
+    bool ok = fread(magic, 1, 4, file) == 4 && memcmp(magic, HISTORY_MAGIC, 4) == 0 &&
+              fread(header, sizeof(unsigned int), 2, file) == 2 && header[0] == HISTORY_VERSION;
+
+    std::vector<Section> sections;
+    for (unsigned int s = 0; ok && s < header[1]; s++) {
+        unsigned int fields[2];
+        ok = fread(fields, sizeof(unsigned int), 2, file) == 2 && fields[0] >= 1 && fields[0] <= 1000;
+        if (!ok) break;
+
+        Section section;
+        section.boardSize = (int)fields[0];
+        section.games = (int)fields[1];
+        section.heat.resize(section.boardSize * section.boardSize);
+        ok = fread(section.heat.data(), sizeof(unsigned short), section.heat.size(), file) == section.heat.size();
+        sections.push_back(section);
+    }
+    fclose(file);
+    if (!ok) return false;
+
+    others.clear();
+    for (const Section& section : sections) {
+        if (section.boardSize == boardSize) {
+            games = section.games;
+            heat = section.heat;
+        } else {
+            others.push_back(section);
+        }
+    }
+    return true;
+}
+
+// Write to a temporary file and rename it over the old one
+bool ShotHistory::save(const std::string& path) const {
+    std::string temp = path + ".tmp";
+    FILE* file = fopen(temp.c_str(), "wb");
+    if (!file) return false;
+
+    unsigned int header[2] = { HISTORY_VERSION, (unsigned int)others.size() + 1 };
+    bool ok = fwrite(HISTORY_MAGIC, 1, 4, file) == 4 && fwrite(header, sizeof(unsigned int), 2, file) == 2;
+
+    std::vector<const Section*> sections;
+    for (const Section& section : others) sections.push_back(&section);
+    Section current;
+    current.boardSize = boardSize;
+    current.games = games;
+    current.heat = heat;
+    sections.push_back(&current);
+
+    for (const Section* section : sections) {
+        if (!ok) break;
+        unsigned int fields[2] = { (unsigned int)section->boardSize, (unsigned int)section->games };
+        ok = fwrite(fields, sizeof(unsigned int), 2, file) == 2 &&
+             fwrite(section->heat.data(), sizeof(unsigned short), section->heat.size(), file) == section->heat.size();
+    }
+    ok = (fclose(file) == 0) && ok;
+    if (!ok) {
+        remove(temp.c_str());
+        return false;
+    }
+    remove(path.c_str());
+    return rename(temp.c_str(), path.c_str()) == 0;
+}
+
+// Earlier shots weigh more; halve the whole map before a cell would overflow
+void ShotHistory::recordShot(int x, int y) {
+    if (x < 0 || x >= boardSize || y < 0 || y >= boardSize) return;
+
+    int cells = boardSize * boardSize;
+    int order = shotsThisGame < cells ? shotsThisGame : cells - 1;
+    int weight = 1 + (HISTORY_MAX_WEIGHT - 1) * (cells - 1 - order) / (cells > 1 ? cells - 1 : 1);
+    shotsThisGame++;
+
+    unsigned short& cell = heat[y * boardSize + x];
+    if (cell + weight > 0xffff) {
+        for (unsigned short& value : heat) value >>= 1;
+    }
+    cell += (unsigned short)weight;
+}
+
+void ShotHistory::endGame() {
+    if (shotsThisGame == 0) return;
+    games++;
+    shotsThisGame = 0;
+}
+
+// The local player's shots are the ones aimed at the AI
+void ShotHistory::onEvent(const GameEvent& event) {
+    if (event.type == EVENT_GAME_OVER) {
+        endGame();
+        return;
+    }
+    if (event.side != PLAYER_SIDE) return;
+    if (event.type == EVENT_MISS || event.type == EVENT_HIT || event.type == EVENT_SUNK) {
+        recordShot(event.x, event.y);
+    }
+}
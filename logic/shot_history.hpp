@@ -0,0 +1,64 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: shot_history.hpp
+ * Description: Header file for ShotHistory, a per-opponent heat map of where that
+ *              opponent shoots. It is a GameEventConsumer that weights each of the
+ *              player's shots by how early in the game it came (early shots show
+ *              where the player looks first), and is kept on disk between games so
+ *              the AI can place its fleet on cells the player tends to try last.
+ *
+ * File format (native byte order), one section per board size:
+ *   "SBHM" <version u32> <sections u32>
+ *   per section: <boardSize u32> <games u32> <heat u16 x boardSize^2, row-major>
+ */
+
+#ifndef SHOT_HISTORY_HPP
+#define SHOT_HISTORY_HPP
+
+#include "game_events.hpp"
+#include <string>
+#include <vector>
+
+class ShotHistory : public GameEventConsumer {
+public:
+    explicit ShotHistory(int boardSize);
+
+    // Read the section for this board size; other sections are kept for save()
+    // A missing file is an empty history; returns false only for an unreadable or corrupt file
+    bool load(const std::string& path);
+
+    // Write every section back, this board size updated
+    bool save(const std::string& path) const;
+
+    // Opponent shot at the AI's board; shots of a game must arrive in firing order
+    void recordShot(int x, int y);
+
+    // Close the current game, finished or abandoned (the next shot starts a new one)
+    // Does nothing if no shot came since the last close, so calling it after game over is safe
+    void endGame();
+
+    // Player shots and game over are taken from the event stream
+    void onEvent(const GameEvent& event);
+
+    int getBoardSize() const { return boardSize; }
+    int getGames() const { return games; }
+    const std::vector<unsigned short>& getHeat() const { return heat; }
+
+private:
+    struct Section {
+        int boardSize;
+        int games;
+        std::vector<unsigned short> heat;
+    };
+
+    int boardSize;
+    int games;                          // Finished games in the history
+    int shotsThisGame;                  // Order of the next shot in the current game
+    std::vector<unsigned short> heat;   // Weighted shot count per cell, row-major
+    std::vector<Section> others;        // Sections for other board sizes, written back unchanged
+};
+
+#endif
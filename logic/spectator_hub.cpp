@@ -0,0 +1,133 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: spectator_hub.cpp
+ * Description: Implementation of the SpectatorHub broadcast channel.
+ */
+
+#include "spectator_hub.hpp"
+#include "replay_log.hpp"
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+    #include <errno.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+    #define MSG_NOSIGNAL 0
+#endif
+
+// Whether the last socket error only means "try again later"
+static bool wouldBlock() {
+    #ifdef _WIN32
+        return WSAGetLastError() == WSAEWOULDBLOCK;
+    #else
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    #endif
+}
+
+SpectatorHub::SpectatorHub() : listenSocket(INVALID_SOCKET_VALUE) {
+}
+
+SpectatorHub::~SpectatorHub() {
+    stop();
+}
+
+// Create the non-blocking listening socket and write the stream header
+bool SpectatorHub::start(int port, int boardSize, int shotsPerTurn) {
+    stop();
+
+    // Same dual-stack listener as the game port, but the game loop never waits on it
+    SOCKET_TYPE sock = NetworkLogic::createHostSocket(port);
+    if (sock == INVALID_SOCKET_VALUE) return false;
+    if (!NetworkLogic::setNonBlocking(sock)) {
+        closesocket(sock);
+        return false;
+    }
+
+    listenSocket = sock;
+    char header[32];
+    formatReplayHeader(boardSize, shotsPerTurn, header, sizeof(header));
+    history = header;
+    history += '\n';
+    return true;
+}
+
+// Accept new spectators, then push any history they have not seen yet
+void SpectatorHub::poll() {
+    if (!isRunning()) return;
+
+    while ((int)spectators.size() < MAX_SPECTATORS) {
+        SOCKET_TYPE client = accept(listenSocket, nullptr, nullptr);
+        if (client == INVALID_SOCKET_VALUE) break;
+        if (!NetworkLogic::setNonBlocking(client)) {
+            closesocket(client);
+            continue;
+        }
+        Spectator spectator;
+        spectator.socket = client;
+        spectator.sentOffset = 0;
+        spectators.push_back(spectator);
+    }
+    flush();
+}
+
+// Serialize once; spectators receive it at the next flush
+void SpectatorHub::onEvent(const GameEvent& event) {
+    if (!isRunning()) return;
+
+    char line[64];
+    int length = formatReplayLine(event, line, sizeof(line) - 1);
+    if (length <= 0) return;
+    line[length++] = '\n';
+    history.append(line, length);
+
+    if (event.type == EVENT_VOLLEY_END || event.type == EVENT_GAME_OVER) {
+        flush();
+    }
+}
+
+// Send each spectator the part of the shared history it is missing
+// Slow spectators keep their offset and catch up later; broken ones are dropped
+void SpectatorHub::flush() {
+    size_t i = 0;
+    while (i < spectators.size()) {
+        Spectator& spectator = spectators[i];
+        bool dropped = false;
+
+        while (spectator.sentOffset < history.size()) {
+            int sent = send(spectator.socket, history.data() + spectator.sentOffset,
+                            (int)(history.size() - spectator.sentOffset), MSG_NOSIGNAL);
+            if (sent > 0) {
+                spectator.sentOffset += sent;
+            } else {
+                dropped = (sent == 0 || !wouldBlock());
+                break;
+            }
+        }
+
+        if (dropped) {
+            closesocket(spectator.socket);
+            spectators[i] = spectators.back();
+            spectators.pop_back();
+        } else {
+            i++;
+        }
+    }
+}
+
+// Deliver what can be delivered and close everything
+void SpectatorHub::stop() {
+    flush();
+    for (size_t i = 0; i < spectators.size(); i++) {
+        closesocket(spectators[i].socket);
+    }
+    spectators.clear();
+    if (listenSocket != INVALID_SOCKET_VALUE) {
+        closesocket(listenSocket);
+        listenSocket = INVALID_SOCKET_VALUE;
+    }
+}
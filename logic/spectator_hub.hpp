@@ -0,0 +1,64 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: spectator_hub.hpp
+ * Description: Header file for the SpectatorHub, which streams a networked match to
+ *              any number of read-only observers. Events are serialized once into a
+ *              single shared history buffer (replay log lines); every spectator socket
+ *              only keeps an offset into it, so each extra spectator costs one
+ *              non-blocking send per flush and no extra serialization. Late joiners
+ *              start at offset 0 and receive the whole match so far.
+ */
+
+#ifndef SPECTATOR_HUB_HPP
+#define SPECTATOR_HUB_HPP
+
+#include "network_logic.hpp"
+#include "game_events.hpp"
+#include <string>
+#include <vector>
+
+#define SPECTATOR_PORT (PORT + 1)   // Port spectators connect to on the host
+const int MAX_SPECTATORS = 64;
+
+class SpectatorHub : public GameEventConsumer {
+public:
+    SpectatorHub();
+    ~SpectatorHub();
+
+    // Listen for spectators; the stream starts with "B <boardSize> <shotsPerTurn>"
+    // Returns false if the listening socket cannot be created
+    bool start(int port, int boardSize, int shotsPerTurn);
+
+    // Accept waiting spectators and send pending history; never blocks
+    void poll();
+
+    // Append the event to the history; flushed to every spectator at volley end
+    void onEvent(const GameEvent& event);
+
+    // Close all spectator connections and the listening socket
+    void stop();
+
+    bool isRunning() const { return listenSocket != INVALID_SOCKET_VALUE; }
+    int getSpectatorCount() const { return (int)spectators.size(); }
+    size_t getHistorySize() const { return history.size(); }
+
+private:
+    struct Spectator {
+        SOCKET_TYPE socket;
+        size_t sentOffset;      // Bytes of history already delivered
+    };
+
+    void flush();
+
+    SOCKET_TYPE listenSocket;
+    std::string history;                // Serialized event stream shared by all spectators
+    std::vector<Spectator> spectators;
+
+    SpectatorHub(const SpectatorHub&);
+    SpectatorHub& operator=(const SpectatorHub&);
+};
+
+#endif
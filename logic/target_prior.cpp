@@ -0,0 +1,257 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: target_prior.cpp
+ * Description: Implementation of the targeting prior: mapping the file, and
+ *              building a section from replay logs.
+ */
+
+#include "target_prior.hpp"
+#include "replay_log.hpp"
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+static const char PRIOR_MAGIC[4] = { 'S', 'B', 'P', 'R' };
+static const unsigned int PRIOR_VERSION = 1;
+static const unsigned int PRIOR_MAX_SECTIONS = 64;
+static const double PRIOR_SMOOTHING = 8.0;     // Shots of board-average evidence added to every cell
+
+// One entry of the section directory
+struct PriorSection {
+    unsigned int boardSize;
+    unsigned int games;
+    unsigned int offset;
+};
+
+// Check the header and every directory entry against the file size
+static bool readDirectory(const unsigned char* data, size_t size, std::vector<PriorSection>& sections) {
+    unsigned int header[2];
+    if (size < 12 || memcmp(data, PRIOR_MAGIC, 4) != 0) return false;
+    memcpy(header, data + 4, sizeof(header));
+    if (header[0] != PRIOR_VERSION || header[1] > PRIOR_MAX_SECTIONS) return false;
+    if (size < 12 + (size_t)header[1] * sizeof(PriorSection)) return false;
+
+    sections.resize(header[1]);
+    memcpy(sections.data(), data + 12, sections.size() * sizeof(PriorSection));
+    for (const PriorSection& section : sections) {
+        size_t bytes = (size_t)section.boardSize * section.boardSize * sizeof(unsigned short);
+        if (section.boardSize < 1 || section.boardSize > 1000 || section.offset % 2 != 0 ||
+            section.offset > size || bytes > size - section.offset) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TargetPrior::TargetPrior()
+    : weights(nullptr), boardSize(0), games(0), mapping(nullptr), mappingSize(0) {
+}
+
+TargetPrior::~TargetPrior() {
+    close();
+}
+
+// Map the whole file and point weights at our section
+bool TargetPrior::load(const std::string& path, int size) {
+    close();
+
+    const unsigned char* data = nullptr;
+    size_t dataSize = 0;
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        void* mapped = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+            mapping = mapped;
+            mappingSize = (size_t)info.st_size;
+            data = (const unsigned char*)mapped;
+            dataSize = mappingSize;
+        }
+    }
+    ::close(fd);
+#else
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) return false;
+    unsigned char chunk[4096];
+    size_t got;
+    while ((got = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        buffer.insert(buffer.end(), chunk, chunk + got);
+    }
+    fclose(file);
+    data = buffer.data();
+    dataSize = buffer.size();
+#endif
+    if (!data) return false;
+
+    std::vector<PriorSection> sections;
+    if (readDirectory(data, dataSize, sections)) {
+        for (const PriorSection& section : sections) {
+            if ((int)section.boardSize != size) continue;
+            weights = (const unsigned short*)(data + section.offset);
+            boardSize = size;
+            games = (int)section.games;
+        }
+    }
+    if (!weights) close();
+    return weights != nullptr;
+}
+
+// Unmap the file
+void TargetPrior::close() {
+#ifndef _WIN32
+    if (mapping) munmap(mapping, mappingSize);
+#endif
+    mapping = nullptr;
+    mappingSize = 0;
+    buffer.clear();
+    weights = nullptr;
+    boardSize = 0;
+    games = 0;
+}
+
+// Count the ENEMY_SIDE shots and hits per cell in one replay log
+// Games whose header names another board size are skipped; games logged before
+// headers were written (no B line) are counted
+static bool countReplayShots(const std::string& path, int boardSize, std::vector<unsigned int>& shots,
+                             std::vector<unsigned int>& hits, int& games) {
+    FILE* file = fopen(path.c_str(), "r");
+    if (!file) return false;
+
+    char line[128];
+    GameEvent event;
+    int gameSize = 0, gameShots = 0;    // 0 = no header for the current game
+    while (fgets(line, sizeof(line), file)) {
+        if (parseReplayHeader(line, gameSize, gameShots)) continue;
+        if (!parseReplayLine(line, event)) continue;
+        if (gameSize != 0 && gameSize != boardSize) {
+            if (event.type == EVENT_GAME_OVER) gameSize = 0;
+            continue;
+        }
+        if (event.type == EVENT_GAME_OVER) {
+            games++;
+            gameSize = 0;
+            continue;
+        }
+        if (event.side != ENEMY_SIDE) continue;
+        if (event.type != EVENT_MISS && event.type != EVENT_HIT && event.type != EVENT_SUNK) continue;
+        if (event.x < 0 || event.x >= boardSize || event.y < 0 || event.y >= boardSize) continue;
+
+        int cell = event.y * boardSize + event.x;
+        shots[cell]++;
+        if (event.type != EVENT_MISS) hits[cell]++;
+    }
+    fclose(file);
+    return true;
+}
+
+// Read the logs, turn the counts into weights and rewrite the file
+bool buildTargetPrior(const std::vector<std::string>& logPaths, int boardSize,
+                      const std::string& outPath, int& games, std::string& error) {
+    if (boardSize < 1 || boardSize > 1000) {
+        error = "invalid board size";
+        return false;
+    }
+
+    int cells = boardSize * boardSize;
+    std::vector<unsigned int> shots(cells, 0), hits(cells, 0);
+    games = 0;
+    for (const std::string& path : logPaths) {
+        if (!countReplayShots(path, boardSize, shots, hits, games)) {
+            error = "cannot read " + path;
+            return false;
+        }
+    }
+
+    unsigned long long totalShots = 0, totalHits = 0;
+    for (int i = 0; i < cells; i++) {
+        totalShots += shots[i];
+        totalHits += hits[i];
+    }
+    if (totalHits == 0) {
+        error = "no hits on the player's ships in the logs";
+        return false;
+    }
+
+    // Smoothed hit rate of each cell over the board average
+    double average = (double)totalHits / totalShots;
+    std::vector<unsigned short> weights(cells);
+    for (int i = 0; i < cells; i++) {
+        double rate = (hits[i] + PRIOR_SMOOTHING * average) / (shots[i] + PRIOR_SMOOTHING);
+        double weight = rate / average * TARGET_PRIOR_ONE + 0.5;
+        if (weight < TARGET_PRIOR_MIN) weight = TARGET_PRIOR_MIN;
+        if (weight > TARGET_PRIOR_MAX) weight = TARGET_PRIOR_MAX;
+        weights[i] = (unsigned short)weight;
+    }
+
+    // Keep the sections for other board sizes
+    std::vector<unsigned char> old;
+    FILE* in = fopen(outPath.c_str(), "rb");
+    if (in) {
+        unsigned char chunk[4096];
+        size_t got;
+        while ((got = fread(chunk, 1, sizeof(chunk), in)) > 0) old.insert(old.end(), chunk, chunk + got);
+        fclose(in);
+    }
+    std::vector<PriorSection> oldSections, sections;
+    if (!old.empty() && !readDirectory(old.data(), old.size(), oldSections)) {
+        error = outPath + " is not a prior file";
+        return false;
+    }
+    for (const PriorSection& section : oldSections) {
+        if ((int)section.boardSize != boardSize) sections.push_back(section);
+    }
+    if (sections.size() >= PRIOR_MAX_SECTIONS) {
+        error = "too many board sizes in " + outPath;
+        return false;
+    }
+    PriorSection current = { (unsigned int)boardSize, (unsigned int)games, 0 };
+    sections.push_back(current);
+
+    // Lay out the data after the directory, sections back to back
+    unsigned int offset = 12 + (unsigned int)(sections.size() * sizeof(PriorSection));
+    std::vector<unsigned int> sources;
+    for (PriorSection& section : sections) {
+        sources.push_back(section.offset);
+        section.offset = offset;
+        offset += section.boardSize * section.boardSize * sizeof(unsigned short);
+    }
+
+    std::string temp = outPath + ".tmp";
+    FILE* out = fopen(temp.c_str(), "wb");
+    if (!out) {
+        error = "cannot write " + temp;
+        return false;
+    }
+    unsigned int header[2] = { PRIOR_VERSION, (unsigned int)sections.size() };
+    bool ok = fwrite(PRIOR_MAGIC, 1, 4, out) == 4 && fwrite(header, sizeof(unsigned int), 2, out) == 2 &&
+              fwrite(sections.data(), sizeof(PriorSection), sections.size(), out) == sections.size();
+    for (size_t s = 0; ok && s < sections.size(); s++) {
+        size_t bytes = (size_t)sections[s].boardSize * sections[s].boardSize * sizeof(unsigned short);
+        const void* source = (s + 1 == sections.size()) ? (const void*)weights.data()
+                                                         : (const void*)(old.data() + sources[s]);
+        ok = fwrite(source, 1, bytes, out) == bytes;
+    }
+    ok = (fclose(out) == 0) && ok;
+    if (!ok) {
+        remove(temp.c_str());
+        error = "cannot write " + temp;
+        return false;
+    }
+    remove(outPath.c_str());
+    if (rename(temp.c_str(), outPath.c_str()) != 0) {
+        error = "cannot replace " + outPath;
+        return false;
+    }
+    return true;
+}
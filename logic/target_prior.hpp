@@ -0,0 +1,70 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: target_prior.hpp
+ * Description: Header file for TargetPrior, a per-board-size heat map of where
+ *              players put their ships, built offline from replay logs and used by
+ *              the Smart AI to weight its placement density. The file is mapped
+ *              read-only, so loading it costs one mmap no matter how large it is.
+ *
+ * File format (native byte order):
+ *   "SBPR" <version u32> <sections u32>
+ *   per section: <boardSize u32> <games u32> <offset u32>
+ *   at each offset: <weight u16 x boardSize^2, row-major>
+ * Weights are 8.8 fixed point: TARGET_PRIOR_ONE is an average cell.
+ */
+
+#ifndef TARGET_PRIOR_HPP
+#define TARGET_PRIOR_HPP
+
+#include <string>
+#include <vector>
+
+// Weight of a cell whose ships turn up as often as the board average
+const unsigned short TARGET_PRIOR_ONE = 256;
+
+// Weight range written by buildTargetPrior (a quarter to four times the average)
+const unsigned short TARGET_PRIOR_MIN = TARGET_PRIOR_ONE / 4;
+const unsigned short TARGET_PRIOR_MAX = TARGET_PRIOR_ONE * 4;
+
+class TargetPrior {
+public:
+    TargetPrior();
+    ~TargetPrior();
+
+    // Map the file and find the section for boardSize
+    // Returns false if the file is missing, corrupt or has no such section
+    bool load(const std::string& path, int boardSize);
+    void close();
+
+    bool isLoaded() const { return weights != nullptr; }
+    int getBoardSize() const { return boardSize; }
+    int getGames() const { return games; }
+
+    // 8.8 fixed-point weight of cell (x, y); only valid while loaded
+    unsigned short weight(int x, int y) const { return weights[y * boardSize + x]; }
+
+private:
+    const unsigned short* weights;      // Section inside the mapping
+    int boardSize;
+    int games;
+    void* mapping;                      // Whole file, mapped read-only
+    size_t mappingSize;
+    std::vector<unsigned char> buffer;  // File contents where mmap is unavailable
+
+    TargetPrior(const TargetPrior&);
+    TargetPrior& operator=(const TargetPrior&);
+};
+
+// Build the section for boardSize from replay logs of games on that board size and
+// write it to outPath, keeping the file's sections for other sizes
+// Ship cells are taken from ENEMY_SIDE hits, i.e. the local player's ships. Each cell
+// gets its smoothed hit rate relative to the board average, so cells the AI happened
+// to shoot more often are not favoured.
+// games: set to the number of finished games read; error: reason on failure
+bool buildTargetPrior(const std::vector<std::string>& logPaths, int boardSize,
+                      const std::string& outPath, int& games, std::string& error);
+
+#endif
@@ -0,0 +1,132 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: turn_engine.cpp
+ * Description: Implementation of the TurnEngine and the event drain helper.
+ */
+
+#include "turn_engine.hpp"
+
+// Pop every queued event and hand it to each consumer in order
+int drainGameEvents(GameEventRing& ring, GameEventConsumer* const* consumers, int consumerCount) {
+    int delivered = 0;
+    GameEvent event;
+    while (ring.pop(event)) {
+        for (int i = 0; i < consumerCount; i++) {
+            if (consumers[i]) consumers[i]->onEvent(event);
+        }
+        delivered++;
+    }
+    return delivered;
+}
+
+// Create an engine over an existing game state
+TurnEngine::TurnEngine(GameState& gameState)
+    : state(gameState), ring(nullptr), side(PLAYER_SIDE), gameOverSent(false), droppedEvents(0) {
+}
+
+// Queue one event if a ring is attached
+void TurnEngine::emit(int type, int x, int y, int value) {
+    if (!ring) return;
+
+    GameEvent event;
+    event.type = (unsigned char)type;
+    event.side = (unsigned char)side;
+    event.x = (short)x;
+    event.y = (short)y;
+    event.value = (short)value;
+    event.turn = state.turnNumber;
+    if (!ring->push(event)) droppedEvents++;
+}
+
+// Emit SUNK for the shot followed by one SUNK_CELL per cell in `cells`
+void TurnEngine::emitSunk(int x, int y) {
+    emit(EVENT_SUNK, x, y, (int)cells.size());
+    for (const auto& cell : cells) {
+        emit(EVENT_SUNK_CELL, cell.first, cell.second, 0);
+    }
+}
+
+// Emit GAME_OVER once, as soon as either side has lost every ship
+void TurnEngine::checkGameOver() {
+    if (gameOverSent || !isOver()) return;
+    gameOverSent = true;
+    emit(EVENT_GAME_OVER, -1, -1, state.enemyShipsRemaining <= 0 ? PLAYER_SIDE : ENEMY_SIDE);
+}
+
+// Start a volley for the side whose turn it is
+void TurnEngine::beginVolley(int announcedShots) {
+    side = state.playerTurn ? PLAYER_SIDE : ENEMY_SIDE;
+    volley.clear(side == PLAYER_SIDE);
+    emit(EVENT_VOLLEY_BEGIN, -1, -1, announcedShots);
+}
+
+// Resolve a player shot against a local ship board
+int TurnEngine::firePlayerShot(BoardData& target, int x, int y) {
+    int result = target.receiveShot(x, y);
+    resolvePlayerShot(x, y, result, &target);
+    return result;
+}
+
+// Apply a resolved player shot to the state
+void TurnEngine::resolvePlayerShot(int x, int y, int result, const BoardData* shipSource) {
+    volley.addShot(x, y, result);
+    state.recordPlayerShot(x, y, result);
+
+    if (result == 0) {
+        emit(EVENT_MISS, x, y, 0);
+    } else if (result == 1) {
+        emit(EVENT_HIT, x, y, 0);
+    } else {
+        cells.clear();
+        if (shipSource) {
+            // Exact ship cells are known
+            cells = shipSource->getShipOccupiedCells(x, y);
+            for (const auto& cell : cells) {
+                state.markEnemySunk(cell.first, cell.second);
+            }
+        } else {
+            // Only our own record of hits is available
+            state.floodEnemySunk(x, y, cells);
+        }
+        emitSunk(x, y);
+    }
+    checkGameOver();
+}
+
+// Apply an enemy shot to the player's board
+int TurnEngine::resolveEnemyShot(int x, int y) {
+    int result = state.receiveEnemyShot(x, y);
+    volley.addShot(x, y, result);
+
+    if (result == 0) {
+        emit(EVENT_MISS, x, y, 0);
+    } else if (result == 1) {
+        emit(EVENT_HIT, x, y, 0);
+    } else {
+        cells = state.playerBoard.getShipOccupiedCells(x, y);
+        emitSunk(x, y);
+    }
+    checkGameOver();
+    return result;
+}
+
+// Count cells hit this volley that are still afloat, then pass the turn
+void TurnEngine::endVolley() {
+    const BoardData& target = (side == PLAYER_SIDE) ? state.enemyBoard : state.playerBoard;
+    for (int i = 0; i < volley.shotCount; i++) {
+        const VolleyShot& shot = volley.shots[i];
+        if (target.boardArray[shot.y][shot.x] == 'x') {
+            volley.woundedCount++;
+        }
+    }
+    emit(EVENT_VOLLEY_END, -1, -1, volley.woundedCount);
+    state.endTurn();
+}
+
+// One side has no ships left
+bool TurnEngine::isOver() const {
+    return state.playerShipsRemaining <= 0 || state.enemyShipsRemaining <= 0;
+}
@@ -0,0 +1,68 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: turn_engine.hpp
+ * Description: Header file for the TurnEngine class. The engine resolves volleys
+ *              against a GameState (shot results, sinking, win detection) and emits
+ *              typed events into a GameEventRing. It has no UI or network code; with
+ *              no ring attached it emits nothing and runs at full speed.
+ */
+
+#ifndef TURN_ENGINE_HPP
+#define TURN_ENGINE_HPP
+
+#include "game_events.hpp"
+#include "../data/game_state.hpp"
+#include "../data/volley_summary.hpp"
+#include <utility>
+#include <vector>
+
+class TurnEngine {
+public:
+    explicit TurnEngine(GameState& gameState);
+
+    // Send events to ring (nullptr = no events)
+    void attach(GameEventRing* eventRing) { ring = eventRing; }
+
+    // Start a volley for the side whose turn it is
+    // announcedShots: shots the side intends to fire (informational)
+    void beginVolley(int announcedShots);
+
+    // Player shot resolved locally against the enemy's ship board (AI games)
+    // Returns: 0 = miss, 1 = hit, 2 = ship sunk
+    int firePlayerShot(BoardData& target, int x, int y);
+
+    // Player shot whose result is already known (e.g. answered over the network)
+    // shipSource: board holding the enemy ships for exact sunk cells, or nullptr to
+    //             flood-fill connected hits on the player's record of the enemy board
+    void resolvePlayerShot(int x, int y, int result, const BoardData* shipSource);
+
+    // Enemy shot at the player's board
+    // Returns: 0 = miss, 1 = hit, 2 = ship sunk
+    int resolveEnemyShot(int x, int y);
+
+    // Finish the volley: count wounded cells and pass the turn
+    void endVolley();
+
+    bool isOver() const;                                   // One side has no ships left
+    const VolleySummary& getVolley() const { return volley; }
+    GameState& getState() { return state; }
+    int getDroppedEvents() const { return droppedEvents; }  // Events lost to a full ring
+
+private:
+    void emit(int type, int x, int y, int value);
+    void emitSunk(int x, int y);
+    void checkGameOver();
+
+    GameState& state;
+    GameEventRing* ring;
+    VolleySummary volley;                       // Volley in progress
+    int side;                                    // Side firing the current volley
+    std::vector<std::pair<int, int>> cells;      // Scratch list of sunk ship cells
+    bool gameOverSent;
+    int droppedEvents;
+};
+
+#endif
@@ -15,7 +15,11 @@
 #include "game/game_modes.hpp"
 #include "game/ai_game_loop.hpp"
 #include "game/multiplayer_game_loop.hpp"
+#include "game/simulation.hpp"
+#include "game/bot_match.hpp"
+#include "game/spectator_view.hpp"
 #include "tests/SeaBattle_1_test.hpp"
+#include "data/trace.hpp"
 #include <locale.h>
 #include <cstdlib>
 #include <ctime>
@@ -24,8 +28,57 @@
 GameSettings g_gameSettings;
 
 int main(int argc, char **argv) {
-    (void)argc;
-    (void)argv;
+    // Chrome trace of the run, written at exit (--trace <file>, TRACE=1 builds);
+    // taken out of argv so the commands below see their usual arguments
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) != "--trace") continue;
+        if (!TRACE_COMPILED) fprintf(stderr, "--trace: tracing is not compiled in (build with make TRACE=1)\n");
+        setTraceOutput(argv[i + 1]);
+        for (int j = i; j + 2 < argc; j++) argv[j] = argv[j + 2];
+        argc -= 2;
+        break;
+    }
+    
+    // Headless batch mode - runs without the ncurses UI
+    if (argc > 1 && std::string(argv[1]) == "--simulate") {
+        return runSimulationCommand(argc, argv);
+    }
+    
+    // Rate AI configurations against each other over a simulated tournament
+    if (argc > 1 && std::string(argv[1]) == "--ladder") {
+        return runLadderCommand(argc, argv);
+    }
+    
+    // Shots-to-win distribution of self-play on every standard board size
+    if (argc > 1 && std::string(argv[1]) == "--shot-report") {
+        return runShotReportCommand(argc, argv);
+    }
+    
+    // Offline: turn replay logs into a targeting prior
+    if (argc > 1 && std::string(argv[1]) == "--build-prior") {
+        return runBuildPriorCommand(argc, argv);
+    }
+    
+    // External bots: drive one against the AI, or serve the AI as a bot on stdin/stdout
+    if (argc > 1 && std::string(argv[1]) == "--bot-match") {
+        return runBotMatchCommand(argc, argv);
+    }
+    if (argc > 1 && std::string(argv[1]) == "--bot") {
+        return runBotCommand(argc, argv);
+    }
+    
+    // Optional event log, network stats, AI shot history and targeting prior for interactive games
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--replay-log") {
+            g_gameSettings.replayLogPath = argv[i + 1];
+        } else if (std::string(argv[i]) == "--net-stats") {
+            g_gameSettings.netStatsPath = argv[i + 1];
+        } else if (std::string(argv[i]) == "--shot-history") {
+            g_gameSettings.shotHistoryPath = argv[i + 1];
+        } else if (std::string(argv[i]) == "--target-prior") {
+            g_gameSettings.targetPriorPath = argv[i + 1];
+        }
+    }
     
     // Enable locale support for proper character display
     setlocale(LC_ALL, "");
@@ -46,6 +99,16 @@ int main(int argc, char **argv) {
     // Initialize ncurses UI
     UIRenderer::setupWindow();
     
+    // Watch a hosted match instead of playing (--spectate <host>)
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--spectate") {
+            watchMultiplayerGame(argv[i + 1]);
+            UIRenderer::cleanup();
+            NetworkLogic::cleanupNetworking();
+            return 0;
+        }
+    }
+    
     int selectedOption = 0;
     bool running = true;
     
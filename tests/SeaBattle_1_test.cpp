@@ -16,6 +16,24 @@
 #include "../data/game_state.hpp"
 #include "../logic/game_logic.hpp"
 #include "../logic/ai_logic.hpp"
+#include "../data/sparse_board.hpp"
+#include "../data/session_arena.hpp"
+#include "../data/volley_summary.hpp"
+#include "../game/simulation.hpp"
+#include "../logic/turn_engine.hpp"
+#include "../logic/replay_log.hpp"
+#include "../logic/spectator_hub.hpp"
+#include "../logic/net_session.hpp"
+#include "../logic/placement_density.hpp"
+#include "../logic/endgame_solver.hpp"
+#include "../logic/shot_history.hpp"
+#include "../logic/target_prior.hpp"
+#include "../game/bot_match.hpp"
+#include "../logic/rating_ladder.hpp"
+#include "../logic/quantile_sketch.hpp"
+#include "../data/trace.hpp"
+#include "../data/alloc_stats.hpp"
+#include "../ui/perf_hud.hpp"
 #include "../ui/ui_config.hpp"
 #include "../ui/ui_renderer.hpp"
 #include <fstream>
@@ -23,6 +41,9 @@
 #include <cstring>
 #include <sstream>
 #include <set>
+#include <chrono>
+#include <cmath>
+#include <thread>
 
 #ifdef _WIN32
     #include <windows.h>
@@ -30,6 +51,7 @@
     #define SLEEP_MS(x) Sleep(x)
 #else
     #include <unistd.h>
+    #include <sys/wait.h>
     #include <ncurses.h>
     #define SLEEP_MS(x) usleep((x) * 1000)
 #endif
@@ -395,6 +417,51 @@ static void testSmartAI() {
     bool behaviorOk = (afterSink.x >= 0 && afterSink.y >= 0);
     addTestResult("AI Smart: Hunt Mode Reset", behaviorOk,
                   "Continues after sink");
+    
+    // Test line locking: two hits in a row are extended along the row only
+    AILogic smartAI4(SMART, 10);
+    smartAI4.recordShotResult(5, 5, true, false);
+    smartAI4.recordShotResult(6, 5, true, false);
+    AICoordinates lineShot = smartAI4.pickAttackCoordinates();
+    bool firstEnd = lineShot.y == 5 && (lineShot.x == 4 || lineShot.x == 7);
+    smartAI4.recordShotResult(lineShot.x, lineShot.y, false, false);
+    AICoordinates otherEnd = smartAI4.pickAttackCoordinates();
+    bool lineOk = firstEnd && otherEnd.y == 5 && otherEnd.x == (lineShot.x == 4 ? 7 : 4);
+    addTestResult("AI Smart: Line Lock", lineOk,
+                  "(" + std::to_string(lineShot.x) + "," + std::to_string(lineShot.y) + ") then (" +
+                  std::to_string(otherEnd.x) + "," + std::to_string(otherEnd.y) + ")");
+    
+    // Both ends closed: the hits were ships side by side, so the cells beside them are tried
+    smartAI4.recordShotResult(otherEnd.x, otherEnd.y, false, false);
+    AICoordinates besideShot = smartAI4.pickAttackCoordinates();
+    bool besideOk = (besideShot.x == 5 || besideShot.x == 6) && (besideShot.y == 4 || besideShot.y == 6);
+    addTestResult("AI Smart: Closed Line", besideOk,
+                  "falls back to (" + std::to_string(besideShot.x) + "," + std::to_string(besideShot.y) + ")");
+    
+    // Each AI draws from its own engine: two built back to back search in different orders,
+    // and the same seed repeats the same order
+    FleetConfig fleet = getFleetConfig(10);
+    AILogic first(SMART, 10);
+    AILogic second(SMART, 10);
+    AILogic seeded(SMART, fleet, nullptr, 12345);
+    AILogic reseeded(SMART, fleet, nullptr, 12345);
+    bool differ = false;
+    bool repeat = true;
+    for (int i = 0; i < 30; i++) {
+        AICoordinates a = first.pickAttackCoordinates();
+        AICoordinates b = second.pickAttackCoordinates();
+        AICoordinates c = seeded.pickAttackCoordinates();
+        AICoordinates d = reseeded.pickAttackCoordinates();
+        first.recordShotResult(a.x, a.y, false, false);
+        second.recordShotResult(b.x, b.y, false, false);
+        seeded.recordShotResult(c.x, c.y, false, false);
+        reseeded.recordShotResult(d.x, d.y, false, false);
+        if (a.x != b.x || a.y != b.y) differ = true;
+        if (c.x != d.x || c.y != d.y) repeat = false;
+    }
+    addTestResult("AI Smart: Independent Seeds", differ && repeat,
+                  std::string(differ ? "orders differ" : "same order") + ", seed " +
+                  (repeat ? "repeats" : "does not repeat"));
 }
 
 /*
@@ -427,6 +494,31 @@ static void testGameState() {
     bool playerWon = state.hasPlayerWon();
     addTestResult("GameState: Player Victory", playerWon,
                   "Player reached max hits");
+    
+    // Test per-shot updates keep fog of war, enemy board and counters in step
+    GameState play;
+    GameLogic::initializeGame(play, 10, 3, true);
+    play.recordPlayerShot(1, 1, 0);
+    play.recordPlayerShot(4, 2, 1);
+    play.recordPlayerShot(4, 3, 2);
+    std::vector<std::pair<int, int>> sunk;
+    play.floodEnemySunk(4, 3, sunk);
+    addTestResult("GameState: Player Shot Updates", 
+                  play.getEnemyKnown(1, 1) == 'm' && play.getEnemyKnown(4, 2) == 's' &&
+                  play.enemyBoard.boardArray[2][4] == 's' && sunk.size() == 2 &&
+                  play.playerHits == 2 && play.enemyShipsRemaining == play.totalShips - 1,
+                  "miss, hit, sunk (2 cells)");
+    
+    // Test enemy shots update the player's board and counters once
+    play.playerBoard.addShip(0, 5 * 10 + 6, 2, 'A');
+    int hit = play.receiveEnemyShot(6, 5);
+    int sunkShot = play.receiveEnemyShot(5, 5);
+    play.endTurn();
+    addTestResult("GameState: Enemy Shot Updates", 
+                  hit == 1 && sunkShot == 2 && play.enemyHits == 2 &&
+                  play.playerShipsRemaining == play.totalShips - 1 &&
+                  !play.playerTurn && play.turnNumber == 1,
+                  "hit, sunk, turn passed");
 }
 
 /*
@@ -516,6 +608,1219 @@ static void testCoordinateSystem() {
                   std::to_string(cells.size()) + " cells");
 }
 
+/*
+ * Test Category 13: Custom Fleets
+ * Tests fleet parsing, large fleets with repeating symbols, and manual ship registration
+ */
+static void testCustomFleets() {
+    // Test parsing a large fleet definition
+    std::istringstream definition(
+        "# stress fleet\n"
+        "BOARD 50\n"
+        "SHOTS 12\n"
+        "SHIP 3 20   # cruisers\n"
+        "SHIP 6 5\n"
+        "SHIP 1 15\n");
+    FleetConfig fleet;
+    std::string error;
+    bool parsed = parseFleetConfig(definition, fleet, error);
+    addTestResult("Fleet: Parse Definition", 
+                  parsed && fleet.boardSize == 50 && fleet.getTotalShips() == 40 &&
+                  fleet.ships[0].length == 6,
+                  parsed ? "40 ships, longest first" : error);
+    
+    // Test malformed definitions are rejected
+    std::istringstream badShip("BOARD 10\nSHIP 11 1\n");
+    std::istringstream noBoard("SHIP 2 2\n");
+    FleetConfig rejected;
+    bool rejectsBad = !parseFleetConfig(badShip, rejected, error) &&
+                      !parseFleetConfig(noBoard, rejected, error);
+    addTestResult("Fleet: Reject Invalid", rejectsBad, "long ship, missing BOARD");
+    
+    // Test every ship sinks independently even though symbols repeat
+    AILogic ai(SMART, fleet);
+    BoardData& board = ai.getBoard();
+    int sunkReports = 0;
+    for (int y = 0; y < board.boardSize; y++) {
+        for (int x = 0; x < board.boardSize; x++) {
+            if (board.receiveShot(x, y) == 2) sunkReports++;
+        }
+    }
+    addTestResult("Fleet: 40 Ships Sink", 
+                  (int)board.myShips.size() == 40 && sunkReports == 40 &&
+                  board.getRemainingShips() == 0,
+                  std::to_string(sunkReports) + "/40 sunk");
+    
+    // Test manually placed ships are registered and can be sunk
+    BoardData manual(10);
+    GameLogic::placeShip(manual, 4, 6, 1, 3, 'M');
+    int first = manual.receiveShot(4, 4);
+    int second = manual.receiveShot(4, 5);
+    int third = manual.receiveShot(4, 6);
+    addTestResult("Fleet: Manual Ship Sinks", first == 1 && second == 1 && third == 2,
+                  "hit, hit, sunk");
+}
+
+/*
+ * Test Category 14: Sparse Board
+ * Tests the sparse placement experiment on boards far beyond MAX_BOARD_SIZE
+ */
+static void testSparseBoard() {
+    // Test placement of a 200-ship fleet on a 1000x1000 board
+    FleetConfig fleet;
+    fleet.boardSize = 1000;
+    fleet.ships.push_back({5, 100});
+    fleet.ships.push_back({3, 100});
+    
+    SparseBoardData board;
+    std::vector<GamePiece> pieces;
+    GameLogic::initializeGamePieces(board, pieces, fleet);
+    GameLogic::generateBoardPlacement(board, pieces);
+    addTestResult("Sparse: 1000x1000 Placement", 
+                  board.myShips.size() == 200 &&
+                  (int)board.shipCells.size() == fleet.getTotalShipCells(),
+                  std::to_string(board.shipCells.size()) + " cells stored");
+    
+    // Test every ship sinks and only shot cells are stored
+    int sunkReports = 0;
+    for (size_t s = 0; s < board.myShips.size(); s++) {
+        const ActiveShip ship = board.myShips[s];
+        for (int i = 0; i < ship.length; i++) {
+            int r = ship.startRow + (ship.orientation == 1 ? i : 0);
+            int c = ship.startCol - (ship.orientation == 1 ? 0 : i);
+            if (board.receiveShot(c, r) == 2) sunkReports++;
+        }
+    }
+    addTestResult("Sparse: All Ships Sink", 
+                  sunkReports == 200 && board.getRemainingShips() == 0 &&
+                  board.shotCells.size() == board.shipCells.size(),
+                  std::to_string(sunkReports) + "/200 sunk");
+    
+    // Test placement reaches the whole of a 1000000x1000000 board, not just the
+    // first 32768 rows and columns a 15-bit rand() could address
+    FleetConfig spread;
+    spread.boardSize = SPARSE_MAX_BOARD_SIZE;
+    spread.ships.push_back({2, 100});
+    SparseBoardData wide;
+    GameLogic::initializeGamePieces(wide, pieces, spread);
+    GameLogic::generateBoardPlacement(wide, pieces);
+    int farRow = 0, farCol = 0;
+    for (const ActiveShip& ship : wide.myShips) {
+        farRow = std::max(farRow, ship.startRow);
+        farCol = std::max(farCol, ship.startCol);
+    }
+    addTestResult("Sparse: Placement Spread", wide.myShips.size() == 100 && farRow > 32767 && farCol > 32767,
+                  "farthest row " + std::to_string(farRow) + ", column " + std::to_string(farCol));
+    
+    // Test miss, repeated shot and cell states on a 1000000x1000000 board
+    SparseBoardData huge(SPARSE_MAX_BOARD_SIZE);
+    huge.addShip(1, 999998LL * SPARSE_MAX_BOARD_SIZE + 999999, 2, 'A');
+    int miss = huge.receiveShot(0, 0);
+    int repeat = huge.receiveShot(0, 0);
+    int hit = huge.receiveShot(999999, 999998);
+    int sunk = huge.receiveShot(999999, 999999);
+    bool outOfBounds = huge.checkStartingPeg(1, 999999LL * SPARSE_MAX_BOARD_SIZE, 2) == 2;
+    addTestResult("Sparse: Huge Board Shots", 
+                  miss == 0 && repeat == 0 && hit == 1 && sunk == 2 && outOfBounds &&
+                  huge.getMissCount() == 1 && huge.getCell(0, 0) == 'o' &&
+                  huge.getCell(999999, 998) == 'w' && huge.getCell(999999, 999998) == 's',
+                  "miss, repeat, hit, sunk");
+}
+
+/*
+ * Test Category 15: Session Arena
+ * Tests arena allocation and reset, arena-backed boards, and the batch simulator
+ */
+static void testSessionArena() {
+    // Test a board allocated from an arena behaves like a heap board
+    SessionArena arena;
+    bool boardOk;
+    {
+        BoardData board(12, &arena);
+        board.addShip(1, 2 * 12 + 5, 3, 'A');
+        int hit = board.receiveShot(5, 2);
+        int miss = board.receiveShot(0, 0);
+        board.receiveShot(5, 3);
+        int sunk = board.receiveShot(5, 4);
+        boardOk = hit == 1 && miss == 0 && sunk == 2 && board.getRemainingShips() == 0 &&
+                  board.getArena() == &arena && arena.getBytesUsed() > 0;
+    }
+    addTestResult("Arena: Board Allocation", boardOk,
+                  std::to_string(arena.getBytesUsed()) + " bytes used");
+    
+    // Test reset rewinds without releasing blocks
+    size_t capacity = arena.getCapacity();
+    arena.reset();
+    addTestResult("Arena: O(1) Reset", 
+                  arena.getBytesUsed() == 0 && arena.getCapacity() == capacity,
+                  std::to_string(capacity) + " bytes kept");
+    
+    // Test the simulator reuses the same arena memory across games
+    FleetConfig fleet = getFleetConfig(10);
+    SimulationSummary single = runSimulation(SMART, EASY, fleet, 1);
+    SimulationSummary batch = runSimulation(SMART, EASY, fleet, 20);
+    addTestResult("Arena: Batch Simulation", 
+                  batch.games == 20 && batch.winsFirst + batch.winsSecond == 20 &&
+                  batch.totalShots >= 20 * fleet.getTotalShipCells() &&
+                  batch.arenaCapacity <= 2 * single.arenaCapacity,
+                  std::to_string(batch.arenaCapacity) + " bytes for 20 games");
+}
+
+/*
+ * Test Category 16: Volley Summary
+ * Tests structured volley records and allocation-free text formatting
+ */
+static void testVolleySummary() {
+    // Test formatting matches the in-game volley line
+    VolleySummary volley;
+    volley.clear(true);
+    volley.addShot(0, 4, SHOT_HIT);
+    volley.addShot(2, 9, SHOT_SUNK);
+    volley.addShot(7, 0, SHOT_MISS);
+    volley.woundedCount = 1;
+    char text[VOLLEY_TEXT_SIZE];
+    size_t length = volley.format(text, sizeof(text));
+    std::string expected = "A5,C10,H1 - 1 wounded, 1 sunk, 1 miss";
+    addTestResult("Volley: Format", text == expected && length == expected.size(), text);
+    
+    // Test structured totals
+    addTestResult("Volley: Totals", 
+                  volley.shotCount == 3 && volley.missCount == 1 && volley.sunkCount == 1 &&
+                  volley.shots[1].x == 2 && volley.shots[1].y == 9 && volley.shots[1].result == SHOT_SUNK,
+                  "3 shots, 1 miss, 1 sunk");
+    
+    // Test small buffers truncate and full volleys reject extra shots
+    char small[8];
+    size_t truncated = volley.format(small, sizeof(small));
+    VolleySummary full;
+    full.clear(false);
+    int accepted = 0;
+    for (int i = 0; i < VOLLEY_MAX_SHOTS + 5; i++) {
+        if (full.addShot(i % 26, i / 26, SHOT_MISS)) accepted++;
+    }
+    addTestResult("Volley: Capacity Limits", 
+                  truncated == 7 && std::string(small) == "A5,C10," && accepted == VOLLEY_MAX_SHOTS,
+                  std::to_string(accepted) + " shots kept");
+}
+
+// Collects events for inspection
+struct EventRecorder : public GameEventConsumer {
+    std::vector<GameEvent> events;
+    void onEvent(const GameEvent& event) { events.push_back(event); }
+};
+
+/*
+ * Test Category 17: Turn Engine
+ * Tests event emission, sinking, win detection and the replay log format
+ */
+static void testTurnEngine() {
+    // Single two-cell ship on each side
+    GameState state;
+    GameLogic::initializeGame(state, 10, 3, true);
+    state.enemyShipsRemaining = 1;
+    state.playerShipsRemaining = 1;
+    state.playerBoard.addShip(1, 0 * 10 + 0, 2, 'A');
+    BoardData enemyShips(10);
+    enemyShips.addShip(0, 4 * 10 + 5, 2, 'B');
+    
+    GameEventRing ring;
+    TurnEngine engine(state);
+    engine.attach(&ring);
+    EventRecorder recorder;
+    GameEventConsumer* consumers[] = { &recorder };
+    
+    // Test a player volley: miss, hit, then a flood-filled sink
+    engine.beginVolley(3);
+    engine.firePlayerShot(enemyShips, 9, 9);
+    engine.firePlayerShot(enemyShips, 5, 4);
+    engine.endVolley();
+    int delivered = drainGameEvents(ring, consumers, 1);
+    bool firstVolley = delivered == 4 &&
+                       recorder.events[0].type == EVENT_VOLLEY_BEGIN && recorder.events[0].value == 3 &&
+                       recorder.events[1].type == EVENT_MISS && recorder.events[2].type == EVENT_HIT &&
+                       recorder.events[3].type == EVENT_VOLLEY_END && recorder.events[3].value == 1 &&
+                       !state.playerTurn;
+    addTestResult("Engine: Volley Events", firstVolley, std::to_string(delivered) + " events");
+    
+    // Test an enemy volley, then a sinking player shot that ends the game
+    recorder.events.clear();
+    engine.beginVolley(1);
+    int enemyResult = engine.resolveEnemyShot(0, 0);
+    engine.endVolley();
+    engine.beginVolley(1);
+    engine.resolvePlayerShot(4, 4, 2, nullptr);
+    drainGameEvents(ring, consumers, 1);
+    // Expect ... SUNK, SUNK_CELL, SUNK_CELL, GAME_OVER
+    const GameEvent& sunk = recorder.events[recorder.events.size() - 4];
+    const GameEvent& over = recorder.events.back();
+    addTestResult("Engine: Sunk And Game Over", 
+                  enemyResult == 1 && recorder.events[1].side == ENEMY_SIDE &&
+                  sunk.type == EVENT_SUNK && sunk.value == 2 &&
+                  over.type == EVENT_GAME_OVER && over.value == PLAYER_SIDE && engine.isOver() &&
+                  state.getEnemyKnown(5, 4) == 's',
+                  "flood fill marked 2 cells");
+    
+    // Test the replay log round trip
+    char line[64];
+    formatReplayLine(sunk, line, sizeof(line));
+    GameEvent parsed;
+    bool roundTrip = parseReplayLine(line, parsed) && parsed.type == EVENT_SUNK &&
+                     parsed.x == 4 && parsed.y == 4 && parsed.value == 2 && parsed.turn == sunk.turn;
+    addTestResult("Engine: Replay Line", roundTrip && !parseReplayLine("Q 1 2", parsed), line);
+    
+    // Test the engine runs without a ring attached
+    GameState headless;
+    GameLogic::initializeGame(headless, 10, 3, true);
+    TurnEngine quiet(headless);
+    quiet.beginVolley(1);
+    quiet.firePlayerShot(enemyShips, 0, 9);
+    quiet.endVolley();
+    addTestResult("Engine: Headless", 
+                  quiet.getDroppedEvents() == 0 && headless.turnNumber == 1 &&
+                  headless.getEnemyKnown(0, 9) == 'm',
+                  "no events, state updated");
+}
+
+// Read from a spectator socket until the text contains `until` (or the socket fails)
+static std::string readSpectatorStream(SOCKET_TYPE sock, const char* until) {
+    std::string text;
+    char buffer[512];
+    while (text.find(until) == std::string::npos) {
+        int received = recv(sock, buffer, sizeof(buffer), 0);
+        if (received <= 0) break;
+        text.append(buffer, received);
+    }
+    return text;
+}
+
+/*
+ * Test Category 18: Spectator Hub
+ * Tests fan-out of one event stream to several spectators over loopback
+ */
+static void testSpectatorHub() {
+    const int testPort = SPECTATOR_PORT + 100;
+    SpectatorHub hub;
+    bool started = hub.start(testPort, 10, 3);
+    addTestResult("Spectators: Start", started, "listening on port " + std::to_string(testPort));
+    if (!started) return;
+    
+    SOCKET_TYPE first = NetworkLogic::createClientSocket("127.0.0.1", testPort);
+    SOCKET_TYPE second = NetworkLogic::createClientSocket("127.0.0.1", testPort);
+    SLEEP_MS(50);
+    hub.poll();
+    
+    // One volley: begin, miss, end (the end flushes)
+    GameEvent event = {};
+    event.type = EVENT_VOLLEY_BEGIN; event.value = 1;
+    hub.onEvent(event);
+    event.type = EVENT_MISS; event.x = 2; event.y = 3; event.value = 0;
+    hub.onEvent(event);
+    event.type = EVENT_VOLLEY_END; event.x = -1; event.y = -1;
+    hub.onEvent(event);
+    
+    std::string expected = "B 10 3\nV 0 0 1\nM 0 0 2 3\nE 0 0 0\n";
+    std::string firstText = readSpectatorStream(first, "E 0 0 0\n");
+    std::string secondText = readSpectatorStream(second, "E 0 0 0\n");
+    addTestResult("Spectators: Fan-Out", 
+                  hub.getSpectatorCount() == 2 && firstText == expected && secondText == expected,
+                  std::to_string(hub.getSpectatorCount()) + " spectators, identical streams");
+    
+    // A late joiner receives the whole history
+    SOCKET_TYPE late = NetworkLogic::createClientSocket("127.0.0.1", testPort);
+    SLEEP_MS(50);
+    hub.poll();
+    std::string lateText = readSpectatorStream(late, "E 0 0 0\n");
+    addTestResult("Spectators: Late Join", lateText == expected, std::to_string(lateText.size()) + " bytes replayed");
+    
+    closesocket(first);
+    closesocket(second);
+    closesocket(late);
+    hub.stop();
+}
+
+#ifndef _WIN32
+// Client half of the resume test, run in a child process
+// Exit code 0 = every step behaved as expected
+static int runResumeClient(int testPort) {
+    SOCKET_TYPE sock = INVALID_SOCKET_VALUE;
+    for (int attempt = 0; attempt < 20 && sock == INVALID_SOCKET_VALUE; attempt++) {
+        sock = NetworkLogic::createClientSocket("127.0.0.1", testPort);
+        if (sock == INVALID_SOCKET_VALUE) SLEEP_MS(50);
+    }
+    NetSession session;
+    session.setHeartbeatInterval(20);
+    if (sock == INVALID_SOCKET_VALUE || !session.startClient("127.0.0.1", sock, testPort)) return 1;
+    
+    int seq, count, x, y;
+    if (!session.receiveVolley(seq, count) || seq != 5 || count != 2) return 2;
+    if (!session.receiveShot(0, x, y) || x != 3 || y != 4) return 3;
+    session.answerShot(2);
+    
+    // The host drops the connection here; shot 1 arrives after the reconnect
+    while (!session.receiveShot(1, x, y)) {
+        if (!session.resume(5)) return 4;
+    }
+    if (x != 7 || y != 8) return 5;
+    session.answerShot(0);
+    
+    // Answer the host's heartbeats until it hangs up
+    for (int i = 0; i < 100 && session.heartbeat(); i++) SLEEP_MS(5);
+    return 0;
+}
+#endif
+
+/*
+ * Test Category 19: Net Session
+ * Tests reconnecting mid-volley over loopback: the re-sent shot is answered
+ * from the defender's result cache and the volley continues
+ */
+static void testNetSession() {
+#ifdef _WIN32
+    addTestResult("Net Session: Resume", true, "skipped (needs fork)");
+#else
+    const int testPort = PORT + 102;
+    SOCKET_TYPE listenSocket = NetworkLogic::createHostSocket(testPort);
+    if (listenSocket == INVALID_SOCKET_VALUE) {
+        addTestResult("Net Session: Handshake", false, "cannot listen on port " + std::to_string(testPort));
+        return;
+    }
+    
+    pid_t child = fork();
+    if (child == 0) {
+        _exit(runResumeClient(testPort));
+    }
+    
+    bool accepted = false;
+    SOCKET_TYPE clientSocket = NetworkLogic::acceptClientConnection(listenSocket, accepted);
+    NetSession session;
+    session.setHeartbeatInterval(20);
+    bool started = accepted && session.startHost(listenSocket, clientSocket);
+    addTestResult("Net Session: Handshake", started && session.getSessionId() != 0,
+                  "session id " + std::to_string(session.getSessionId()));
+    
+    int first = -1, again = -1, second = -1;
+    if (started) {
+        session.beginVolley(5, 2);
+        session.fireShot(0, 3, 4, first);
+        
+        // Drop the connection and wait for the client to dial back in
+        bool resumed = session.resume(5);
+        addTestResult("Net Session: Resume", resumed && session.getResumeCount() == 1,
+                      std::to_string(session.getResumeCount()) + " resume(s)");
+        
+        // Shot 0 again: answered from the cache, not re-resolved
+        if (resumed) {
+            session.fireShot(0, 3, 4, again);
+            session.fireShot(1, 7, 8, second);
+            for (int i = 0; i < 60; i++) {
+                session.heartbeat();
+                SLEEP_MS(5);
+            }
+        }
+    }
+    addTestResult("Net Session: Cached Result", first == 2 && again == 2,
+                  "first " + std::to_string(first) + ", replayed " + std::to_string(again));
+    
+    NetStats stats = session.getStats();
+    char statusLine[64];
+    formatNetStatus(stats, statusLine, sizeof(statusLine));
+    addTestResult("Net Session: Heartbeat RTT", 
+                  stats.rttSamples >= 2 && stats.rttMinMs <= stats.rttAvgMs && stats.rttMinMs <= stats.rttP99Ms &&
+                  stats.bytesSent > 0 && stats.bytesReceived > 0,
+                  statusLine);
+    
+    // Machine-readable dump: one JSON object per line
+    const char* statsPath = "net_stats_test.jsonl";
+    remove(statsPath);
+    bool written = writeNetStatsJson(stats, session.getSessionId(), statsPath);
+    std::ifstream statsFile(statsPath);
+    std::string json;
+    std::getline(statsFile, json);
+    statsFile.close();
+    remove(statsPath);
+    addTestResult("Net Session: Stats JSON",
+                  written && json.find("\"session\":" + std::to_string(session.getSessionId())) != std::string::npos &&
+                  json.find("\"rtt_ms\":{\"samples\":" + std::to_string(stats.rttSamples)) != std::string::npos &&
+                  json.back() == '}',
+                  std::to_string(json.size()) + " bytes");
+    
+    session.close();
+    int status = -1;
+    waitpid(child, &status, 0);
+    int exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    addTestResult("Net Session: Shot After Resume", second == 0 && exitCode == 0,
+                  "result " + std::to_string(second) + ", client exit " + std::to_string(exitCode));
+    
+    // A client that connects and never says HELLO is dropped after the handshake timeout
+    SOCKET_TYPE silent = NetworkLogic::createClientSocket("127.0.0.1", testPort);
+    SOCKET_TYPE silentPeer = NetworkLogic::acceptClientConnection(listenSocket, accepted);
+    NetSession silentHost;
+    silentHost.setHandshakeTimeout(200);
+    auto start = std::chrono::steady_clock::now();
+    bool silentStarted = accepted && silentHost.startHost(listenSocket, silentPeer);
+    double waitedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    addTestResult("Net Session: Silent Client", accepted && !silentStarted && waitedMs < 2000,
+                  "gave up after " + std::to_string((int)waitedMs) + "ms");
+    silentHost.close();
+    if (silent != INVALID_SOCKET_VALUE) closesocket(silent);
+    closesocket(listenSocket);
+#endif
+}
+
+/*
+ * Test Category 20: Address Resolution
+ * Tests getaddrinfo resolution, the dual-stack host socket, and that a dead
+ * address only delays the connection by the attempt delay
+ */
+static void testAddressResolution() {
+    const int testPort = PORT + 103;
+    
+    std::vector<NetAddress> local;
+    bool resolved = NetworkLogic::resolveAddresses("localhost", testPort, local);
+    addTestResult("Resolve: Localhost", resolved && !local.empty(), std::to_string(local.size()) + " address(es)");
+    
+    std::future<std::vector<NetAddress>> lookup = NetworkLogic::resolveAsync("127.0.0.1", testPort);
+    bool ready = lookup.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+    size_t asyncCount = ready ? lookup.get().size() : 0;
+    addTestResult("Resolve: Background Thread", asyncCount == 1, std::to_string(asyncCount) + " address(es)");
+    
+    SOCKET_TYPE listenSocket = NetworkLogic::createHostSocket(testPort);
+    if (listenSocket == INVALID_SOCKET_VALUE) {
+        addTestResult("Host Socket: Dual Stack", false, "cannot listen on port " + std::to_string(testPort));
+        return;
+    }
+    
+    // IPv4 always; IPv6 loopback only where the machine has it
+    SOCKET_TYPE v4 = NetworkLogic::createClientSocket("127.0.0.1", testPort);
+    std::vector<NetAddress> v6Address;
+    bool hasV6 = NetworkLogic::resolveAddresses("::1", testPort, v6Address);
+    SOCKET_TYPE v6 = hasV6 ? NetworkLogic::connectFirst(v6Address) : INVALID_SOCKET_VALUE;
+    addTestResult("Host Socket: Dual Stack", v4 != INVALID_SOCKET_VALUE && (!hasV6 || v6 != INVALID_SOCKET_VALUE),
+                  std::string("IPv4 ") + (v4 != INVALID_SOCKET_VALUE ? "ok" : "failed") +
+                  ", IPv6 " + (!hasV6 ? "unavailable" : v6 != INVALID_SOCKET_VALUE ? "ok" : "failed"));
+    
+    // An unroutable documentation address first, loopback second
+    std::vector<NetAddress> race, loopback;
+    NetworkLogic::resolveAddresses("192.0.2.1", testPort, race);
+    NetworkLogic::resolveAddresses("127.0.0.1", testPort, loopback);
+    race.insert(race.end(), loopback.begin(), loopback.end());
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    SOCKET_TYPE raced = NetworkLogic::connectFirst(race);
+    long long elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    addTestResult("Connect: Dead Address Skipped", raced != INVALID_SOCKET_VALUE && elapsedMs < 2000,
+                  std::to_string(elapsedMs) + " ms");
+    
+    if (v4 != INVALID_SOCKET_VALUE) closesocket(v4);
+    if (v6 != INVALID_SOCKET_VALUE) closesocket(v6);
+    if (raced != INVALID_SOCKET_VALUE) closesocket(raced);
+    closesocket(listenSocket);
+}
+
+/*
+ * Test Category 21: AI Prefetch
+ * Tests that a volley planned on a snapshot is the volley the AI would fire
+ */
+static void testAIPrefetch() {
+    AILogic fleetOwner(SMART, 10);
+    BoardData& target = fleetOwner.getBoard();
+    int shipsBefore = target.getRemainingShips();
+    
+    AILogic ai(SMART, 10);
+    AIVolleyPlan plan = ai.prefetchVolley(target, 12).get();
+    bool untouched = target.getRemainingShips() == shipsBefore &&
+                     target.getMissCount() == 0;
+    addTestResult("Prefetch: Board Untouched", untouched && plan.after != nullptr,
+                  std::to_string(plan.shots.size()) + " shots planned on a copy");
+    
+    // Fire the same volley live and compare
+    BoardData live = target;
+    bool same = plan.shots.size() == 12;
+    for (size_t i = 0; i < plan.shots.size() && same; i++) {
+        AICoordinates shot = ai.pickAttackCoordinates();
+        int result = live.receiveShot(shot.x, shot.y);
+        ai.recordShotResult(shot.x, shot.y, result != 0, result == 2);
+        if (result == 2) ai.recordSunkShip(live.getShipOccupiedCells(shot.x, shot.y));
+        same = shot.x == plan.shots[i].x && shot.y == plan.shots[i].y && result == plan.results[i];
+    }
+    addTestResult("Prefetch: Matches Live Volley", same, "12 shots, identical targets and results");
+    
+    // After adopting, the AI continues exactly where the planner stopped
+    AILogic adopter(EASY, 10);
+    AIVolleyPlan easyPlan = adopter.prefetchVolley(target, 5).get();
+    adopter.adoptTargeting(*easyPlan.after);
+    AICoordinates next = adopter.pickAttackCoordinates();
+    AICoordinates expected = easyPlan.after->pickAttackCoordinates();
+    bool repeated = false;
+    for (const auto& shot : easyPlan.shots) {
+        if (shot.x == next.x && shot.y == next.y) repeated = true;
+    }
+    addTestResult("Prefetch: Adopted State", next.x == expected.x && next.y == expected.y && !repeated,
+                  "next shot (" + std::to_string(next.x) + "," + std::to_string(next.y) + ")");
+}
+
+/*
+ * Test Category 22: Placement Density
+ * Tests the vector density kernel against a direct count and the AI's sunk-ship tracking
+ */
+static void naiveDensity(const unsigned int* blocked, int size, const std::vector<int>& counts,
+                         std::vector<unsigned short>& density) {
+    density.assign(size * size, 0);
+    for (int length = 1; length < (int)counts.size(); length++) {
+        for (int vertical = 0; vertical < (length == 1 ? 1 : 2); vertical++) {
+            for (int y = 0; y < size; y++) {
+                for (int x = 0; x < size; x++) {
+                    bool fits = true;
+                    for (int k = 0; k < length && fits; k++) {
+                        int cx = vertical ? x : x + k;
+                        int cy = vertical ? y + k : y;
+                        fits = cx < size && cy < size && !(blocked[cy] & (1u << cx));
+                    }
+                    for (int k = 0; fits && k < length; k++) {
+                        int cx = vertical ? x : x + k;
+                        int cy = vertical ? y + k : y;
+                        density[cy * size + cx] += counts[length];
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void testPlacementDensity() {
+    const int sizes[] = { 10, 13, 26, 32 };
+    bool allMatch = true;
+    std::string detail = placementDensityKernel();
+    for (int size : sizes) {
+        FleetConfig fleet = getFleetConfig(size < 26 ? size : 26);
+        std::vector<int> counts(fleet.getLongestShip() + 1, 0);
+        for (const FleetEntry& entry : fleet.ships) counts[entry.length] += entry.count;
+        
+        for (int trial = 0; trial < 5; trial++) {
+            unsigned int blocked[DENSITY_MAX_BOARD] = {0};
+            for (int y = 0; y < size; y++) {
+                for (int x = 0; x < size; x++) {
+                    if (rand() % 4 == 0) blocked[y] |= 1u << x;
+                }
+            }
+            std::vector<unsigned short> expected, fast, scalar;
+            naiveDensity(blocked, size, counts, expected);
+            bool ok = computePlacementDensity(blocked, size, counts, fast) &&
+                      computePlacementDensityScalar(blocked, size, counts, scalar);
+            if (!ok || fast != expected || scalar != expected) {
+                allMatch = false;
+                detail = "mismatch on " + std::to_string(size) + "x" + std::to_string(size);
+            }
+        }
+    }
+    addTestResult("Density: Kernel Matches Count", allMatch, detail + ", boards 10-32");
+    
+    std::vector<unsigned short> tooLarge;
+    unsigned int rows[DENSITY_MAX_BOARD] = {0};
+    bool rejected = !computePlacementDensity(rows, DENSITY_MAX_BOARD + 1, std::vector<int>(3, 1), tooLarge) &&
+                    tooLarge.empty();
+    addTestResult("Density: Large Board Rejected", rejected, "boards over 32 fall back");
+    
+    // 5000 one-cell ships cover every cell 5000 times: the counts stop at the maximum
+    std::vector<int> manySingles(2, 0);
+    manySingles[1] = 5000;
+    std::vector<unsigned short> saturated, saturatedScalar;
+    bool saturates = computePlacementDensity(rows, 10, manySingles, saturated) &&
+                     computePlacementDensityScalar(rows, 10, manySingles, saturatedScalar) &&
+                     saturated == saturatedScalar &&
+                     saturated == std::vector<unsigned short>(100, (unsigned short)DENSITY_MAX_COUNT);
+    addTestResult("Density: Saturates", saturates,
+                  "count " + std::to_string(saturated.empty() ? 0 : saturated[0]) + " for 5000 placements");
+    
+    // Sinking a three-deck ship blocks its cells and removes it from the fleet
+    AILogic ai(SMART, 10);
+    const FleetConfig& fleet = ai.getFleet();
+    std::vector<int> counts(fleet.getLongestShip() + 1, 0);
+    for (const FleetEntry& entry : fleet.ships) counts[entry.length] += entry.count;
+    ai.recordShotResult(2, 2, true, false);
+    ai.recordShotResult(3, 2, true, false);
+    ai.recordShotResult(4, 2, true, true);
+    counts[3]--;
+    unsigned int sunkRows[DENSITY_MAX_BOARD] = {0};
+    sunkRows[2] = (1u << 2) | (1u << 3) | (1u << 4);
+    std::vector<unsigned short> expected;
+    naiveDensity(sunkRows, 10, counts, expected);
+    addTestResult("Density: Sunk Ship Tracked", ai.getDensityGrid() == expected,
+                  "3-deck ship at (2-4, 2)");
+    
+    // Search shots go to the densest parity cell
+    AILogic searcher(SMART, 10);
+    std::vector<unsigned short> grid = searcher.getDensityGrid();
+    int best = 0;
+    for (int y = 0; y < 10; y++) {
+        for (int x = 0; x < 10; x++) {
+            if ((x + y) % 2 == 0 && grid[y * 10 + x] > best) best = grid[y * 10 + x];
+        }
+    }
+    AICoordinates first = searcher.pickAttackCoordinates();
+    addTestResult("Density: Densest Parity Shot", (first.x + first.y) % 2 == 0 && grid[first.y * 10 + first.x] == best,
+                  "first shot (" + std::to_string(first.x) + "," + std::to_string(first.y) + ")");
+}
+
+/*
+ * Test Category 23: Endgame Solver
+ * Tests exact layout enumeration and the Smart AI's switch into endgame mode
+ */
+static void testEndgameSolver() {
+    // One three-deck ship, only row 2 of a 5x5 board open: placements at x = 0, 1, 2
+    unsigned int blocked[5] = { 0x1f, 0x1f, 0, 0x1f, 0x1f };
+    unsigned int hits[5] = { 0, 0, 0, 0, 0 };
+    std::vector<int> counts(4, 0);
+    counts[3] = 1;
+    EndgameResult result;
+    bool solved = solveEndgame(blocked, hits, 5, counts, ENDGAME_MAX_LAYOUTS, result);
+    const unsigned int expected[5] = { 1, 2, 3, 2, 1 };
+    bool coverOk = solved && result.layouts == 3;
+    for (int x = 0; x < 5 && coverOk; x++) coverOk = result.cover[2 * 5 + x] == expected[x];
+    addTestResult("Endgame: Exact Count", coverOk, std::to_string(result.layouts) + " layouts, cover 1-2-3-2-1");
+    
+    // A hit at the end of the row leaves one layout
+    hits[2] = 1u << 4;
+    solved = solveEndgame(blocked, hits, 5, counts, ENDGAME_MAX_LAYOUTS, result);
+    addTestResult("Endgame: Hits Constrain", solved && result.layouts == 1 && result.cover[2 * 5 + 2] == 1 &&
+                  result.cover[2 * 5 + 1] == 0, "only x = 2..4 remains");
+    
+    // A hit the ship cannot reach: no layout, reported as 0
+    hits[2] = 0;
+    hits[0] = 1;
+    blocked[0] = 0x1e;
+    solved = solveEndgame(blocked, hits, 5, counts, ENDGAME_MAX_LAYOUTS, result);
+    addTestResult("Endgame: Inconsistent", !solved && result.layouts == 0, "isolated hit, no layout");
+    
+    // A full fleet on an open board is left to density targeting
+    FleetConfig standard = getFleetConfig(10);
+    std::vector<int> fullCounts(standard.getLongestShip() + 1, 0);
+    for (const FleetEntry& entry : standard.ships) fullCounts[entry.length] += entry.count;
+    unsigned int open[10] = {0}, noHits[10] = {0};
+    solved = solveEndgame(open, noHits, 10, fullCounts, ENDGAME_MAX_LAYOUTS, result);
+    addTestResult("Endgame: Too Many Layouts", !solved && result.layouts == -1, "10 ships on an empty board");
+    
+    // Smart AI stays out of the endgame with a full fleet; with one ship left in a
+    // short gap it fires at the most covered cell
+    FleetConfig single;
+    single.boardSize = 10;
+    single.ships.push_back(FleetEntry{3, 1});
+    AILogic ai(SMART, single);
+    AILogic fullFleet(SMART, 10);
+    bool before = fullFleet.inEndgame();
+    for (int y = 0; y < 10; y++) {
+        for (int x = 0; x < 10; x++) {
+            if (y != 5 || x > 4) ai.recordShotResult(x, y, false, false);
+        }
+    }
+    AICoordinates shot = ai.pickAttackCoordinates();
+    addTestResult("Endgame: AI Switches On", !before && ai.inEndgame() && shot.x == 2 && shot.y == 5,
+                  "shot (" + std::to_string(shot.x) + "," + std::to_string(shot.y) + ") of row 5, x 0-4");
+    
+    // Revealed sunk cells replace the guess: a touching wounded ship stays open
+    AILogic tracker(SMART, 10);
+    tracker.recordShotResult(2, 2, true, false);
+    tracker.recordShotResult(3, 2, true, false);
+    tracker.recordShotResult(4, 2, true, true);
+    std::vector<std::pair<int, int>> sunk;
+    sunk.push_back(std::make_pair(3, 2));
+    sunk.push_back(std::make_pair(4, 2));
+    tracker.recordSunkShip(sunk);
+    const std::vector<unsigned short>& grid = tracker.getDensityGrid();
+    addTestResult("Endgame: Revealed Sunk Ship", grid[2 * 10 + 2] > 0 && grid[2 * 10 + 3] == 0,
+                  "hit at (2,2) still open");
+}
+
+/*
+ * Test Category 24: Shot History
+ * Tests the persisted opponent heat map and the placement it biases
+ */
+static void testShotHistory() {
+    const char* historyPath = "shot_history_test.bin";
+    remove(historyPath);
+    
+    // The player always opens on the left half; the AI's own shots are not recorded
+    ShotHistory history(10);
+    GameEvent event;
+    event.side = PLAYER_SIDE;
+    event.type = EVENT_MISS;
+    event.value = 0;
+    event.turn = 0;
+    for (int game = 0; game < 2; game++) {
+        for (int y = 0; y < 10; y++) {
+            for (int x = 0; x < 5; x++) {
+                event.x = (short)x;
+                event.y = (short)y;
+                history.onEvent(event);
+            }
+        }
+        GameEvent enemyShot = event;
+        enemyShot.side = ENEMY_SIDE;
+        enemyShot.x = 9;
+        history.onEvent(enemyShot);
+        GameEvent over = event;
+        over.type = EVENT_GAME_OVER;
+        history.onEvent(over);
+    }
+    const std::vector<unsigned short>& heat = history.getHeat();
+    addTestResult("History: Recorded", history.getGames() == 2 && heat[0] > heat[4 * 10 + 9] && heat[9] == 0,
+                  "early shots weigh more, enemy shots ignored");
+    
+    // A game abandoned before game over counts once; closing it again changes nothing
+    history.endGame();
+    ShotHistory abandoned(10);
+    abandoned.onEvent(event);
+    abandoned.endGame();
+    abandoned.endGame();
+    addTestResult("History: Abandoned Game", history.getGames() == 2 && abandoned.getGames() == 1,
+                  std::to_string(abandoned.getGames()) + " game after quitting");
+    
+    // Sections for other board sizes survive a save
+    ShotHistory other(12);
+    bool saved = history.save(historyPath) && other.load(historyPath) && other.getGames() == 0;
+    other.recordShot(3, 3);
+    other.endGame();
+    saved = saved && other.save(historyPath);
+    ShotHistory reloaded(10), reloadedOther(12);
+    bool loaded = reloaded.load(historyPath) && reloadedOther.load(historyPath);
+    addTestResult("History: Save and Load", saved && loaded && reloaded.getGames() == 2 &&
+                  reloaded.getHeat() == heat && reloadedOther.getGames() == 1,
+                  "10x10 and 12x12 sections in one file");
+    
+    FILE* corrupt = fopen(historyPath, "wb");
+    if (corrupt) {
+        fputs("not a history", corrupt);
+        fclose(corrupt);
+    }
+    ShotHistory rejected(10);
+    addTestResult("History: Corrupt File", !rejected.load(historyPath) && rejected.getGames() == 0,
+                  "rejected, history left empty");
+    remove(historyPath);
+    
+    // Ships go to the cold (right) half
+    AILogic ai(SMART, 10);
+    ai.setupBoard(history);
+    int shipCells = 0, coldCells = 0;
+    for (int y = 0; y < 10; y++) {
+        for (int x = 0; x < 10; x++) {
+            if (ai.getBoard().boardArray[y][x] == 'w') continue;
+            shipCells++;
+            if (x >= 5) coldCells++;
+        }
+    }
+    addTestResult("History: Cold Placement", shipCells == ai.getFleet().getTotalShipCells() &&
+                  coldCells * 10 >= shipCells * 8,
+                  std::to_string(coldCells) + "/" + std::to_string(shipCells) + " ship cells in the cold half");
+    
+    // A 26x26 board is placed well inside a millisecond
+    ShotHistory large(26);
+    for (int y = 0; y < 26; y++) {
+        for (int x = 0; x < 13; x++) large.recordShot(x, y);
+    }
+    large.endGame();
+    AILogic largeAI(SMART, 26);
+    auto start = std::chrono::steady_clock::now();
+    const int runs = 20;
+    for (int i = 0; i < runs; i++) largeAI.setupBoard(large);
+    double micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / runs;
+    addTestResult("History: 26x26 Placement Time", micros < 1000,
+                  std::to_string((int)micros) + " us per fleet");
+}
+
+/*
+ * Test Category 25: Target Prior
+ * Tests building the placement prior from replay logs, mapping it and AI targeting
+ */
+static void testTargetPrior() {
+    const char* logPath = "target_prior_test.log";
+    const char* priorPath = "target_prior_test.bin";
+    remove(priorPath);
+    
+    // The player's ships always sit in column 0; the player's own shots must be ignored
+    FILE* log = fopen(logPath, "w");
+    if (log) {
+        for (int game = 0; game < 40; game++) {
+            fprintf(log, "B 10 5\n");
+            for (int y = 0; y < 10; y++) {
+                for (int x = 0; x < 10; x++) {
+                    fprintf(log, "%c %d %d %d %d\n", x == 0 ? 'H' : 'M', game, ENEMY_SIDE, x, y);
+                }
+                fprintf(log, "H %d %d %d %d\n", game, PLAYER_SIDE, 9, y);
+            }
+            fprintf(log, "G %d %d\n", game, ENEMY_SIDE);
+        }
+        
+        // 20x20 games in the same file, with the pattern reversed: must not reach the 10x10 prior
+        for (int game = 0; game < 40; game++) {
+            fprintf(log, "B 20 5\n");
+            for (int y = 0; y < 10; y++) {
+                fprintf(log, "M %d %d %d %d\n", game, ENEMY_SIDE, 0, y);
+                fprintf(log, "H %d %d %d %d\n", game, ENEMY_SIDE, 9, y);
+            }
+            fprintf(log, "G %d %d\n", game, ENEMY_SIDE);
+        }
+        
+        // A few 12x12 games for a second section
+        for (int game = 0; game < 5; game++) {
+            fprintf(log, "B 12 5\n");
+            for (int y = 0; y < 12; y++) fprintf(log, "H %d %d %d %d\n", game, ENEMY_SIDE, 11, y);
+            fprintf(log, "G %d %d\n", game, ENEMY_SIDE);
+        }
+        fclose(log);
+    }
+    
+    std::vector<std::string> logs(1, logPath);
+    int games = 0;
+    std::string error;
+    bool built = buildTargetPrior(logs, 10, priorPath, games, error);
+    TargetPrior prior;
+    bool loaded = built && prior.load(priorPath, 10);
+    addTestResult("Prior: Build and Map", loaded && games == 40 && prior.getGames() == 40,
+                  built ? "40 games, 10x10 section" : error);
+    addTestResult("Prior: Weights", loaded && prior.weight(0, 5) == TARGET_PRIOR_MAX &&
+                  prior.weight(9, 5) == TARGET_PRIOR_MIN,
+                  "ship column at the maximum, empty cells at the minimum");
+    
+    // A second board size joins the file without disturbing the first
+    bool second = buildTargetPrior(logs, 12, priorPath, games, error);
+    TargetPrior other, reloaded;
+    addTestResult("Prior: Sections", second && games == 5 && other.load(priorPath, 12) && reloaded.load(priorPath, 10) &&
+                  reloaded.weight(0, 5) == TARGET_PRIOR_MAX && !TargetPrior().load(priorPath, 14),
+                  "10x10 and 12x12 kept, 14x14 absent");
+    
+    // A fresh Smart AI opens on the ship column
+    AILogic ai(SMART, 10);
+    ai.setTargetPrior(&reloaded);
+    AICoordinates first = ai.pickAttackCoordinates();
+    addTestResult("Prior: AI Targeting", first.x == 0,
+                  "first shot at (" + std::to_string(first.x) + "," + std::to_string(first.y) + ")");
+    reloaded.close();
+    other.close();
+    prior.close();
+    
+    FILE* corrupt = fopen(priorPath, "wb");
+    if (corrupt) {
+        fputs("SBPR not a prior", corrupt);
+        fclose(corrupt);
+    }
+    TargetPrior rejected;
+    addTestResult("Prior: Corrupt File", !rejected.load(priorPath, 10) && !rejected.isLoaded() &&
+                  !buildTargetPrior(logs, 10, priorPath, games, error),
+                  "not mapped, not overwritten");
+    remove(priorPath);
+    remove(logPath);
+}
+
+/*
+ * Test Category 26: Bot Protocol
+ * Tests the external bot protocol lines and a match against this program as a bot
+ */
+static void testBotProtocol() {
+    FleetConfig fleet = getFleetConfig(10);
+    
+    // A placed fleet survives formatting and parsing
+    AILogic ai(SMART, fleet);
+    std::string fleetLine = formatBotFleet(ai.getBoard());
+    BoardData parsed(10);
+    std::string error;
+    bool same = parseBotFleet(fleetLine, fleet, parsed, error);
+    for (int y = 0; same && y < 10; y++) {
+        for (int x = 0; x < 10; x++) {
+            if ((parsed.boardArray[y][x] == 'w') != (ai.getBoard().boardArray[y][x] == 'w')) same = false;
+        }
+    }
+    addTestResult("Bot: Fleet Round Trip", same && parsed.getRemainingShips() == fleet.getTotalShips(),
+                  same ? "all ship cells match" : error);
+    
+    // Overlapping, off-board and short fleets are refused
+    FleetConfig pair;
+    pair.boardSize = 5;
+    pair.shotsPerTurn = 1;
+    FleetEntry entry = { 3, 2 };
+    pair.ships.push_back(entry);
+    BoardData small(5);
+    bool ok = parseBotFleet("fleet 0 0 h 3 0 v", pair, small, error) && small.boardArray[0][3] == small.boardArray[2][3];
+    bool overlap = !parseBotFleet("fleet 0 0 h 1 0 v", pair, small, error);
+    bool offBoard = !parseBotFleet("fleet 3 0 h 0 1 v", pair, small, error);
+    bool missing = !parseBotFleet("fleet 0 0 h", pair, small, error);
+    addTestResult("Bot: Fleet Validation", ok && overlap && offBoard && missing,
+                  "legal fleet placed, overlap/off-board/short refused");
+    
+    std::vector<AICoordinates> shots;
+    bool shotsOk = parseBotShots("shots 1 2 9 9", 10, 3, shots) && shots.size() == 2 && shots[1].x == 9;
+    bool shotsBad = !parseBotShots("shots 1 2 3", 10, 3, shots) && !parseBotShots("shots 10 0", 10, 3, shots) &&
+                    !parseBotShots("shots 0 0 1 1", 10, 1, shots) && !parseBotShots("shots", 10, 3, shots);
+    addTestResult("Bot: Shots", shotsOk && shotsBad, "pairs on the board, at most one volley");
+    
+    addTestResult("Bot: New Game Line", formatBotNewGame(fleet) == "new 10 " + std::to_string(fleet.shotsPerTurn) +
+                  " 4 3 3 2 2 2 1 1 1 1", formatBotNewGame(fleet));
+    
+#ifdef __linux__
+    // This program answering as a bot on the other end of the pipes
+    char self[4096];
+    ssize_t selfLength = readlink("/proc/self/exe", self, sizeof(self) - 1);
+    self[selfLength > 0 ? selfLength : 0] = '\0';
+    BotProcess bot;
+    bool started = selfLength > 0 && bot.start("'" + std::string(self) + "' --bot easy", error);
+    SimulationSummary summary;
+    if (started) summary = runBotMatch(bot, EASY, fleet, 20, error);
+    unsigned long long roundTrips = bot.getWrites();
+    bot.stop();
+    addTestResult("Bot: Match", started && summary.games == 20 && summary.winsFirst + summary.winsSecond == 20 &&
+                  roundTrips < (unsigned long long)summary.totalTurns,
+                  summary.games == 20 ? std::to_string(roundTrips) + " round trips for 20 games" : error);
+    
+    BotProcess silent;
+    bool refused = silent.start("exit 0", error) && runBotMatch(silent, EASY, fleet, 1, error).games == 0;
+    silent.stop();
+    addTestResult("Bot: Dead Bot", refused, error);
+#endif
+}
+
+/*
+ * Test Category 27: Rating Ladder
+ * Tests the Glicko-1 update, shard merging and a small simulated ladder
+ */
+static void testRatingLadder() {
+    // Worked example from Glickman's Glicko paper
+    RatingLadder example;
+    int player = example.addPlayer("player", 1500, 200);
+    int a = example.addPlayer("a", 1400, 30);
+    int b = example.addPlayer("b", 1550, 100);
+    int c = example.addPlayer("c", 1700, 300);
+    RatingShard games = example.newShard();
+    games.recordGame(player, a, 1.0);
+    games.recordGame(b, player, 1.0);
+    games.recordGame(player, c, 0.0);
+    example.merge(games);
+    example.endPeriod();
+    const PlayerRating& rated = example.getPlayer(player);
+    char values[64];
+    snprintf(values, sizeof(values), "%.1f RD %.1f", rated.rating, rated.rd);
+    addTestResult("Ladder: Glicko Example", fabs(rated.rating - 1464.1) < 0.5 && fabs(rated.rd - 151.4) < 0.5 &&
+                  rated.games == 3 && rated.score == 1.0, values);
+    
+    // Results split over shards rate the same as one stream
+    RatingLadder whole, split;
+    RatingShard all(2), first(2), second(2);
+    for (int i = 0; i < 2; i++) {
+        whole.addPlayer("p" + std::to_string(i));
+        split.addPlayer("p" + std::to_string(i));
+    }
+    for (int g = 0; g < 30; g++) {
+        double score = (g % 3 == 0) ? 0.0 : 1.0;
+        all.recordGame(0, 1, score);
+        (g % 2 ? first : second).recordGame(1, 0, 1.0 - score);
+    }
+    whole.merge(all);
+    split.merge(first);
+    split.merge(second);
+    whole.endPeriod();
+    split.endPeriod();
+    addTestResult("Ladder: Shard Merge", fabs(whole.getPlayer(0).rating - split.getPlayer(0).rating) < 1e-9 &&
+                  whole.getPlayer(0).rating > 1500 && whole.getPlayer(0).rd < GLICKO_INITIAL_RD,
+                  "two shards rate like one");
+    
+    // Five shots a turn beat one, on two worker threads
+    std::vector<LadderConfig> configs;
+    LadderConfig strong = { SMART, 10, 5 };
+    LadderConfig weak = { EASY, 10, 1 };
+    configs.push_back(strong);
+    configs.push_back(weak);
+    RatingLadder ladder;
+    ladder.addPlayer(ladderConfigName(strong));
+    ladder.addPlayer(ladderConfigName(weak));
+    runLadder(ladder, configs, 60, 2, 20);
+    const PlayerRating& top = ladder.getPlayer(0);
+    const PlayerRating& bottom = ladder.getPlayer(1);
+    addTestResult("Ladder: Simulated", ladder.getPeriods() == 3 && top.games == 60 && bottom.games == 60 &&
+                  top.rating - GLICKO_INTERVAL_Z * top.rd > bottom.rating + GLICKO_INTERVAL_Z * bottom.rd,
+                  top.name + " " + std::to_string((int)top.rating) + ", " + bottom.name + " " +
+                  std::to_string((int)bottom.rating));
+}
+
+/*
+ * Test Category 28: Shot Report
+ * Tests the quantile sketch and the self-play shots-to-win report
+ */
+static void testShotReport() {
+    // 1..100000 once each: every quantile within 1% of the exact one
+    QuantileSketch sketch, low, high;
+    for (int v = 1; v <= 100000; v++) {
+        sketch.add(v);
+        (v <= 50000 ? low : high).add(v);
+    }
+    bool accurate = true;
+    const double checks[] = { 0.01, 0.1, 0.5, 0.9, 0.99 };
+    for (double q : checks) {
+        double exact = 1 + q * 99999;
+        if (fabs(sketch.quantile(q) - exact) > 0.01 * exact + 1) accurate = false;
+    }
+    addTestResult("Sketch: Accuracy", accurate && sketch.getMin() == 1 && sketch.getMax() == 100000,
+                  "p50 " + std::to_string((int)sketch.quantile(0.5)) + ", " +
+                  std::to_string(sketch.getBucketCount()) + " buckets");
+    
+    low.merge(high);
+    bool merged = low.getCount() == sketch.getCount() && low.getBucketCount() == sketch.getBucketCount();
+    for (double q : checks) {
+        if (low.quantile(q) != sketch.quantile(q)) merged = false;
+    }
+    addTestResult("Sketch: Merge", merged, "two halves merge into the whole");
+    
+    // Memory stays bounded over a huge range; the top quantiles keep their accuracy
+    QuantileSketch wide;
+    for (int e = -300; e <= 300; e++) wide.add(pow(10.0, e / 10.0));
+    wide.add(0);
+    addTestResult("Sketch: Bounded", wide.getBucketCount() <= SKETCH_MAX_BUCKETS + 1 &&
+                  wide.quantile(1.0) == 1e30 && fabs(wide.quantile(0.99) / pow(10.0, 29.3) - 1) < 0.01 &&
+                  wide.quantile(0) == 0, std::to_string(wide.getBucketCount()) + " buckets for 60 decades");
+    
+    // Self-play report for one board size, as CSV
+    std::vector<int> sizes(1, 10);
+    std::vector<ShotReportRow> rows;
+    runShotReport(sizes, 4, rows, 2024);
+    const char* reportPath = "shot_report_test.csv";
+    bool written = rows.size() == 2 && writeShotReport(reportPath, rows);
+    int lines = 0;
+    std::ifstream report(reportPath);
+    std::string line;
+    while (std::getline(report, line)) lines++;
+    report.close();
+    remove(reportPath);
+    addTestResult("Report: Self-Play CSV", written && lines == 5 && rows[1].shots.getCount() == 4 &&
+                  rows[1].shots.getMin() >= getFleetConfig(10).getTotalShipCells() &&
+                  rows[1].volleys.getMax() <= 100, std::to_string(lines) + " lines");
+    
+    // The same seed replays the same games
+    std::vector<ShotReportRow> again;
+    runShotReport(sizes, 4, again, 2024);
+    bool replayed = again.size() == rows.size();
+    for (size_t i = 0; i < again.size() && replayed; i++) {
+        replayed = again[i].shots.getMean() == rows[i].shots.getMean() &&
+                   again[i].volleys.getMean() == rows[i].volleys.getMean();
+    }
+    addTestResult("Report: Seeded", replayed, "seed 2024 reproduces both rows");
+}
+
+/*
+ * Test Category 29: Tracing
+ * Tests the per-thread span buffers and the Chrome trace output
+ */
+static void recordTestSpans(int count) {
+    for (int i = 0; i < count; i++) {
+        TraceScope span("test span");
+    }
+}
+
+static void testTracing() {
+    resetTrace();
+    
+    // TRACE_SCOPE is a no-op statement unless the build defines SEABATTLE_TRACE
+    {
+        TRACE_SCOPE("test scope");
+    }
+    long long fromMacro = getTraceEventCount();
+    addTestResult("Trace: Compile Switch", fromMacro == (TRACE_COMPILED ? 1 : 0),
+                  TRACE_COMPILED ? "traced build" : "spans compiled out");
+    
+    // Main thread plus two workers (a worker that already exited hands its buffer on)
+    std::thread first(recordTestSpans, 100), second(recordTestSpans, 200);
+    recordTestSpans(50);
+    first.join();
+    second.join();
+    addTestResult("Trace: Threads", getTraceEventCount() == fromMacro + 350 && getTraceDroppedCount() == 0,
+                  std::to_string(getTraceEventCount()) + " spans");
+    
+    const char* tracePath = "trace_test.json";
+    bool written = writeChromeTrace(tracePath);
+    std::ifstream trace(tracePath);
+    std::string line;
+    std::set<std::string> threads;
+    int spans = 0;
+    bool framed = std::getline(trace, line) && line == "{\"traceEvents\":[";
+    while (std::getline(trace, line)) {
+        size_t tid = line.find("\"tid\":");
+        if (line.find("\"name\":\"test span\",\"ph\":\"X\"") == std::string::npos || tid == std::string::npos) continue;
+        spans++;
+        threads.insert(line.substr(tid, line.find(',', tid) - tid));
+    }
+    trace.close();
+    remove(tracePath);
+    addTestResult("Trace: Chrome JSON", written && framed && spans == 350 && threads.size() >= 2,
+                  std::to_string(spans) + " spans on " + std::to_string(threads.size()) + " threads");
+    
+    // A full buffer counts the overflow instead of growing
+    std::thread flood(recordTestSpans, TRACE_BUFFER_EVENTS + 10);
+    flood.join();
+    addTestResult("Trace: Full Buffer", getTraceDroppedCount() >= 10, std::to_string(getTraceDroppedCount()) + " dropped");
+    resetTrace();
+}
+
+/*
+ * Test Category 30: Performance HUD
+ * Tests the allocation counter and the overlay's frame, turn and network rows
+ */
+static void testPerfHud() {
+    unsigned long long before = getAllocationCount();
+    std::vector<int>* numbers = new std::vector<int>(100);
+    delete numbers;
+    addTestResult("HUD: Allocation Counter", getAllocationCount() - before >= 2,
+                  std::to_string(getAllocationCount() - before) + " allocations");
+    
+    // A new turn number closes the count of the turn before
+    PerfHud hud;
+    hud.checkTurn(0);
+    for (int i = 0; i < 10; i++) delete new int(i);
+    hud.checkTurn(0);
+    hud.checkTurn(1);
+    addTestResult("HUD: Allocations Per Turn", hud.getTurnAllocations() >= 10,
+                  std::to_string(hud.getTurnAllocations()) + " in turn 0");
+    
+    char line[64];
+    hud.recordFrame(2500000, 1234);
+    hud.formatLine(1, nullptr, line, sizeof(line));
+    bool frameRow = strstr(line, "2.50ms") != nullptr;
+    hud.formatLine(2, nullptr, line, sizeof(line));
+    bool bytesRow = strstr(line, "1.2k B/frame") != nullptr;
+    hud.recordFrame(1000000, -1);
+    hud.formatLine(2, nullptr, line, sizeof(line));
+    addTestResult("HUD: Frame Rows", frameRow && bytesRow && strstr(line, "n/a") != nullptr, line);
+    
+    NetStats stats = NetStats();
+    stats.rttSamples = 3;
+    stats.rttAvgMs = 12.5;
+    stats.rttP99Ms = 40.0;
+    hud.formatLine(4, &stats, line, sizeof(line));
+    bool rttRow = strstr(line, "12.5ms") != nullptr && strstr(line, "p99 40.0ms") != nullptr;
+    hud.formatLine(4, nullptr, line, sizeof(line));
+    addTestResult("HUD: RTT Row", rttRow && strstr(line, "local") != nullptr, line);
+    
+    // Hidden, the frame hooks sample nothing
+    hud.beginFrame();
+    hud.endFrame();
+    bool idle = hud.getFrameBytes() == -1 && hud.getFrameMs() == 1.0;
+    
+#ifdef __linux__
+    // Shown, bytes written during the frame are counted
+    const char* path = "perf_hud_test.txt";
+    FILE* file = fopen(path, "w");
+    hud.toggle();
+    hud.beginFrame();
+    if (file) {
+        fputs(std::string(4096, 'x').c_str(), file);
+        fflush(file);
+    }
+    hud.endFrame();
+    if (file) fclose(file);
+    remove(path);
+    addTestResult("HUD: Terminal Bytes", idle && file && hud.getFrameBytes() >= 4096,
+                  std::to_string(hud.getFrameBytes()) + " bytes");
+#else
+    addTestResult("HUD: Terminal Bytes", idle, "not measured on this platform");
+#endif
+}
+
 /*
  * Run interactive manual tests with user input
  * Allows testing of all major game features through console interaction
@@ -1827,7 +3132,7 @@ void runDebugTests() {
         if (mode == '1' || mode == '4') {
             if (outputFile.is_open()) {
                 outputFile << "--- AUTOMATIC TESTS ---\n";
-                outputFile << "Running all 12 test categories...\n\n";
+                outputFile << "Running all 30 test categories...\n\n";
             }
             
             clear();
@@ -1910,6 +3215,114 @@ void runDebugTests() {
             testCoordinateSystem();
             SLEEP_MS(100);
             
+            mvprintw(testY++, 2, "Running Category 13: Custom Fleets...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 13: Custom Fleets\n";
+            testCustomFleets();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 14: Sparse Board...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 14: Sparse Board\n";
+            testSparseBoard();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 15: Session Arena...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 15: Session Arena\n";
+            testSessionArena();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 16: Volley Summary...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 16: Volley Summary\n";
+            testVolleySummary();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 17: Turn Engine...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 17: Turn Engine\n";
+            testTurnEngine();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 18: Spectator Hub...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 18: Spectator Hub\n";
+            testSpectatorHub();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 19: Net Session...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 19: Net Session\n";
+            testNetSession();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 20: Address Resolution...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 20: Address Resolution\n";
+            testAddressResolution();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 21: AI Prefetch...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 21: AI Prefetch\n";
+            testAIPrefetch();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 22: Placement Density...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 22: Placement Density\n";
+            testPlacementDensity();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 23: Endgame Solver...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 23: Endgame Solver\n";
+            testEndgameSolver();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 24: Shot History...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 24: Shot History\n";
+            testShotHistory();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 25: Target Prior...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 25: Target Prior\n";
+            testTargetPrior();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 26: Bot Protocol...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 26: Bot Protocol\n";
+            testBotProtocol();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 27: Rating Ladder...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 27: Rating Ladder\n";
+            testRatingLadder();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 28: Shot Report...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 28: Shot Report\n";
+            testShotReport();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 29: Tracing...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 29: Tracing\n";
+            testTracing();
+            SLEEP_MS(100);
+            
+            mvprintw(testY++, 2, "Running Category 30: Performance HUD...");
+            refresh();
+            if (outputFile.is_open()) outputFile << "Category 30: Performance HUD\n";
+            testPerfHud();
+            SLEEP_MS(100);
+            
             mvprintw(testY + 2, 2, "All automatic tests completed!");
             mvprintw(testY + 3, 2, "Press any key to see results...");
             refresh();
@@ -0,0 +1,68 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: board_event_renderer.cpp
+ * Description: Implementation of BoardEventRenderer.
+ */
+
+#include "board_event_renderer.hpp"
+#include "ui_renderer.hpp"
+
+BoardEventRenderer::BoardEventRenderer(BoardScreen& boardScreen) : screen(boardScreen) {
+    lastVolley[PLAYER_SIDE].clear(true);
+    lastVolley[ENEMY_SIDE].clear(false);
+}
+
+// Update the boards and volley summary for one event
+void BoardEventRenderer::onEvent(const GameEvent& event) {
+    switch (event.type) {
+        case EVENT_VOLLEY_BEGIN:
+            volley.clear(event.side == PLAYER_SIDE);
+            break;
+        case EVENT_MISS:
+            volley.addShot(event.x, event.y, SHOT_MISS);
+            drawCell(event, 'o');
+            break;
+        case EVENT_HIT:
+            volley.addShot(event.x, event.y, SHOT_HIT);
+            drawCell(event, 'x');
+            break;
+        case EVENT_SUNK:
+            volley.addShot(event.x, event.y, SHOT_SUNK);
+            drawCell(event, 's');
+            break;
+        case EVENT_SUNK_CELL:
+            drawCell(event, 's');
+            break;
+        case EVENT_VOLLEY_END:
+            volley.woundedCount = event.value;
+            lastVolley[event.side] = volley;
+            drawVolley(event.side);
+            break;
+    }
+}
+
+// Draw the latest volley result of each side again
+void BoardEventRenderer::redrawVolleys() const {
+    for (int side = PLAYER_SIDE; side <= ENEMY_SIDE; side++) {
+        if (lastVolley[side].shotCount > 0) drawVolley(side);
+    }
+}
+
+// Player shots land on the enemy board (right), enemy shots on the player board (left)
+void BoardEventRenderer::drawCell(const GameEvent& event, char cell) {
+    if (event.side == PLAYER_SIDE) {
+        UIRenderer::clearShotIndicator(screen.cellScreenY(event.y), screen.cellScreenX(event.x, false));
+        screen.setCell(event.x, event.y, cell, false);
+    } else {
+        screen.setCell(event.x, event.y, cell, true);
+    }
+}
+
+// Player results two lines below the boards, enemy results three lines further
+void BoardEventRenderer::drawVolley(int side) const {
+    int y = screen.cellScreenY(screen.getBoardSize()) + (side == PLAYER_SIDE ? 2 : 5);
+    UIRenderer::drawVolleyResult(y, screen.getLayout().board1StartX, lastVolley[side]);
+}
@@ -0,0 +1,39 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: board_event_renderer.hpp
+ * Description: Header file for BoardEventRenderer, the game event consumer that draws
+ *              shots onto a BoardScreen and prints the volley result lines. Used by the
+ *              game loop and by the spectator view.
+ */
+
+#ifndef BOARD_EVENT_RENDERER_HPP
+#define BOARD_EVENT_RENDERER_HPP
+
+#include "board_screen.hpp"
+#include "../logic/game_events.hpp"
+#include "../data/volley_summary.hpp"
+
+// Draws turn engine events onto both boards and the volley result lines
+// PLAYER_SIDE shots land on the right board, ENEMY_SIDE shots on the left board
+class BoardEventRenderer : public GameEventConsumer {
+public:
+    explicit BoardEventRenderer(BoardScreen& boardScreen);
+
+    void onEvent(const GameEvent& event);
+
+    // Draw the latest volley result of each side again (after a resize)
+    void redrawVolleys() const;
+
+private:
+    void drawCell(const GameEvent& event, char cell);
+    void drawVolley(int side) const;
+
+    BoardScreen& screen;
+    VolleySummary volley;          // Volley in progress
+    VolleySummary lastVolley[2];   // Latest finished volley per side
+};
+
+#endif
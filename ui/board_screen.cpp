@@ -0,0 +1,120 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: board_screen.cpp
+ * Description: Implementation of BoardScreen, the cached on-screen copy of both boards.
+ */
+
+#include "board_screen.hpp"
+#include "ui_renderer.hpp"
+#include <cstdio>
+
+// Start with empty boards and compute the initial layout
+BoardScreen::BoardScreen(int size, const char* left, const char* right)
+    : boardSize(size), leftTitle(left), rightTitle(right) {
+    layout = calculateBoardLayout(boardSize);
+    glyphs[0].assign(boardSize * boardSize, ' ');
+    glyphs[1].assign(boardSize * boardSize, ' ');
+    buildRows();
+}
+
+// Lay out row labels, cell separators and cell glyphs for the current cell width
+void BoardScreen::buildRows() {
+    int width = rowWidth();
+    for (int side = 0; side < 2; side++) {
+        rows[side].assign(boardSize * width, ' ');
+        for (int y = 0; y < boardSize; y++) {
+            chtype* row = &rows[side][y * width];
+            char label[16];
+            snprintf(label, sizeof(label), "|%2d|", y + 1);
+            for (int i = 0; i < 4; i++) row[i] = (unsigned char)label[i];
+            for (int x = 0; x < boardSize; x++) {
+                chtype* cell = row + 4 + x * layout.cellWidth;
+                cell[1] = glyphs[side][y * boardSize + x];
+                if (layout.cellWidth == STANDARD_CELL_WIDTH) cell[3] = '|';
+            }
+        }
+    }
+}
+
+// Copy every cell of a board into the cache
+void BoardScreen::loadBoard(const BoardData& board, bool isPlayerBoard) {
+    std::vector<chtype>& cache = glyphs[isPlayerBoard ? 0 : 1];
+    for (int y = 0; y < boardSize; y++) {
+        for (int x = 0; x < boardSize; x++) {
+            cache[y * boardSize + x] = UIRenderer::cellGlyph(board.boardArray[y][x], isPlayerBoard);
+        }
+    }
+    buildRows();
+}
+
+// Change one cell and draw it
+void BoardScreen::setCell(int x, int y, char cell, bool isPlayerBoard) {
+    int side = isPlayerBoard ? 0 : 1;
+    chtype glyph = UIRenderer::cellGlyph(cell, isPlayerBoard);
+    glyphs[side][y * boardSize + x] = glyph;
+    rows[side][y * rowWidth() + 4 + x * layout.cellWidth + 1] = glyph;
+    mvaddch(cellScreenY(y), cellScreenX(x, isPlayerBoard), glyph);
+    attron(COLOR_PAIR(1));
+}
+
+// Blit the frame, then every cached row of both boards
+void BoardScreen::draw() const {
+    UIRenderer::drawGameBoards(layout, boardSize, leftTitle.c_str(), rightTitle.c_str());
+
+    int width = rowWidth();
+    for (int y = 0; y < boardSize; y++) {
+        mvaddchnstr(cellScreenY(y), layout.board1StartX, &rows[0][y * width], width);
+        mvaddchnstr(cellScreenY(y), layout.board2StartX + 4, &rows[1][y * width], width);
+    }
+}
+
+// Digits over unshot cells: blue for cold, cyan, yellow, red for the hottest
+void BoardScreen::drawHeat(const std::vector<unsigned short>& heat, bool isPlayerBoard) const {
+    if ((int)heat.size() != boardSize * boardSize) return;
+
+    int peak = 1;
+    for (unsigned short value : heat) {
+        if (value > peak) peak = value;
+    }
+
+    static const int HEAT_COLORS[] = { 3, 6, 5, 4 };
+    const std::vector<chtype>& cache = glyphs[isPlayerBoard ? 0 : 1];
+    for (int y = 0; y < boardSize; y++) {
+        for (int x = 0; x < boardSize; x++) {
+            char cell = (char)(cache[y * boardSize + x] & A_CHARTEXT);
+            if (cell == 'O' || cell == 'X' || cell == 'S') continue;
+
+            int level = heat[y * boardSize + x] * 9 / peak;
+            mvaddch(cellScreenY(y), cellScreenX(x, isPlayerBoard),
+                    (chtype)('0' + level) | COLOR_PAIR(HEAT_COLORS[level * 4 / 10]) | A_BOLD);
+        }
+    }
+    attron(COLOR_PAIR(1));
+}
+
+// Recompute the layout for the current terminal size
+bool BoardScreen::relayout() {
+    BoardLayout updated = calculateBoardLayout(boardSize);
+    bool moved = updated.startY != layout.startY || updated.board1StartX != layout.board1StartX ||
+                 updated.board2StartX != layout.board2StartX || updated.logStartX != layout.logStartX ||
+                 updated.cellWidth != layout.cellWidth;
+    bool rebuild = updated.cellWidth != layout.cellWidth;
+    layout = updated;
+    if (rebuild) buildRows();
+    return moved;
+}
+
+// Whether the current terminal can show both boards
+bool BoardScreen::fits() const {
+    int maxY, maxX;
+    getmaxyx(stdscr, maxY, maxX);
+    return canFitInterface(boardSize, maxY, maxX);
+}
+
+// Screen column of cell x: player board on the left, enemy board on the right
+int BoardScreen::cellScreenX(int x, bool isPlayerBoard) const {
+    return isPlayerBoard ? layout.playerCellX(x) : layout.enemyCellX(x);
+}
@@ -0,0 +1,66 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: board_screen.hpp
+ * Description: Header file for BoardScreen, the on-screen copy of both game boards.
+ *              Every grid row is kept as a ready-to-draw chtype line, so after a
+ *              terminal resize the layout is recomputed and the boards are re-blitted
+ *              one row at a time without walking the board data again. The rows are
+ *              rebuilt from the cached cell glyphs when the cell width changes.
+ */
+
+#ifndef BOARD_SCREEN_HPP
+#define BOARD_SCREEN_HPP
+
+#include "ui_config.hpp"
+#include "../data/board_data.hpp"
+#include <string>
+#include <vector>
+
+class BoardScreen {
+public:
+    BoardScreen(int boardSize, const char* leftTitle, const char* rightTitle);
+
+    // Copy every cell of a board into the cached rows
+    // isPlayerBoard: left board with ships shown, otherwise right board with ships hidden
+    void loadBoard(const BoardData& board, bool isPlayerBoard);
+
+    // Change one cell: update the cached row and draw it at the current layout
+    void setCell(int x, int y, char cell, bool isPlayerBoard);
+
+    // Draw frame and both boards from the cache
+    void draw() const;
+
+    // Overlay per-cell weights on one board as digits 0-9 (scaled to the largest weight);
+    // cells already shot at keep their glyph. draw() removes the overlay.
+    void drawHeat(const std::vector<unsigned short>& heat, bool isPlayerBoard) const;
+
+    // Recompute the layout (position and cell width) for the current terminal size
+    // Returns true if the boards moved
+    bool relayout();
+
+    // Whether the current terminal can show both boards
+    bool fits() const;
+
+    const BoardLayout& getLayout() const { return layout; }
+    int getBoardSize() const { return boardSize; }
+
+    // Screen position of cell (x, y) on either board
+    int cellScreenX(int x, bool isPlayerBoard) const;
+    int cellScreenY(int y) const { return layout.cellY(y); }
+
+private:
+    int rowWidth() const { return 4 + boardSize * layout.cellWidth; }  // "|nn|" then one cell per column
+    void buildRows();
+
+    int boardSize;
+    std::string leftTitle;
+    std::string rightTitle;
+    BoardLayout layout;
+    std::vector<chtype> glyphs[2]; // [0] player board, [1] enemy board; one glyph per cell
+    std::vector<chtype> rows[2];   // Grid rows built from glyphs at the current cell width
+};
+
+#endif
@@ -0,0 +1,162 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: perf_hud.cpp
+ * Description: Implementation of the performance overlay.
+ */
+
+#include "perf_hud.hpp"
+#include "ui_config.hpp"
+#include "../logic/net_session.hpp"
+#include "../data/alloc_stats.hpp"
+#include "../data/trace.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+
+// Bytes this process has passed to write() so far, or -1 where that is not available.
+// On Linux this is "wchar" in /proc/self/io; the file stays open and is re-read in place.
+long long bytesWritten() {
+#ifdef __linux__
+    static int fd = open("/proc/self/io", O_RDONLY);
+    if (fd < 0) return -1;
+
+    char text[512];
+    ssize_t length = pread(fd, text, sizeof(text) - 1, 0);
+    if (length <= 0) return -1;
+    text[length] = '\0';
+
+    const char* field = strstr(text, "wchar:");
+    return field ? atoll(field + 6) : -1;
+#else
+    return -1;
+#endif
+}
+
+} // namespace
+
+// Hidden, with no samples yet
+PerfHud::PerfHud()
+    : shown(false), frameStartNs(0), frameStartBytes(-1), frameMs(0), framePeakMs(0),
+      frameBytes(-1), framePeakBytes(-1), aiMs(-1), turn(-1),
+      turnStartAllocations(getAllocationCount()), turnAllocations(-1) {
+}
+
+// Sample the clock and the write counter only while the HUD is shown
+void PerfHud::beginFrame() {
+    if (!shown) return;
+    frameStartBytes = bytesWritten();
+    frameStartNs = traceNow();
+}
+
+// Record the frame started by beginFrame
+void PerfHud::endFrame() {
+    if (!shown) return;
+    long long elapsed = traceNow() - frameStartNs;
+    long long bytes = frameStartBytes < 0 ? -1 : bytesWritten() - frameStartBytes;
+    recordFrame(elapsed, bytes);
+}
+
+// Keep the last frame and the turn's peak
+void PerfHud::recordFrame(long long elapsedNs, long long bytes) {
+    frameMs = elapsedNs / 1000000.0;
+    if (frameMs > framePeakMs) framePeakMs = frameMs;
+    frameBytes = bytes;
+    if (bytes > framePeakBytes) framePeakBytes = bytes;
+}
+
+// Close the allocation count of the finished turn; peaks start over with the new turn
+void PerfHud::checkTurn(int turnNumber) {
+    if (turnNumber == turn) return;
+
+    unsigned long long now = getAllocationCount();
+    if (turn >= 0) turnAllocations = (long long)(now - turnStartAllocations);
+    turnStartAllocations = now;
+    turn = turnNumber;
+    framePeakMs = 0;
+    framePeakBytes = -1;
+}
+
+// One row of the overlay
+int PerfHud::formatLine(int row, const NetStats* net, char* buffer, size_t bufferSize) const {
+    char count[24], peak[24];
+    int written;
+    switch (row) {
+        case 0:
+            written = snprintf(buffer, bufferSize, "PERFORMANCE (p to hide)");
+            break;
+        case 1:
+            written = snprintf(buffer, bufferSize, "Frame %7.2fms  peak %.2fms", frameMs, framePeakMs);
+            break;
+        case 2:
+            if (frameBytes < 0) {
+                written = snprintf(buffer, bufferSize, "Term  n/a");
+            } else {
+                formatCount((unsigned long long)frameBytes, count, sizeof(count));
+                formatCount((unsigned long long)framePeakBytes, peak, sizeof(peak));
+                written = snprintf(buffer, bufferSize, "Term  %6s B/frame  peak %s", count, peak);
+            }
+            break;
+        case 3:
+            if (aiMs < 0) {
+                written = snprintf(buffer, bufferSize, "AI    --");
+            } else {
+                written = snprintf(buffer, bufferSize, "AI    %7.2fms/volley", aiMs);
+            }
+            break;
+        case 4:
+            if (!net) {
+                written = snprintf(buffer, bufferSize, "RTT   local game");
+            } else if (net->rttSamples == 0) {
+                written = snprintf(buffer, bufferSize, "RTT   --");
+            } else {
+                written = snprintf(buffer, bufferSize, "RTT   %7.1fms  p99 %.1fms", net->rttAvgMs, net->rttP99Ms);
+            }
+            break;
+        case 5:
+            if (turnAllocations < 0) {
+                written = snprintf(buffer, bufferSize, "Alloc --");
+            } else {
+                formatCount((unsigned long long)turnAllocations, count, sizeof(count));
+                written = snprintf(buffer, bufferSize, "Alloc %6s/turn", count);
+            }
+            break;
+        default:
+            written = 0;
+            if (bufferSize > 0) buffer[0] = '\0';
+            break;
+    }
+    return written < 0 ? 0 : written;
+}
+
+// Draw every row, clearing what was there before
+void PerfHud::draw(int y, int x, const NetStats* net) const {
+    char line[64];
+    for (int row = 0; row < PERF_HUD_LINES; row++) {
+        formatLine(row, net, line, sizeof(line));
+        move(y + row, x);
+        clrtoeol();
+        attron(COLOR_PAIR(row == 0 ? 5 : 6));
+        if (row == 0) attron(A_BOLD);
+        printw("%s", line);
+        attroff(A_BOLD);
+    }
+    attron(COLOR_PAIR(1));
+}
+
+// Clear the rows the overlay used
+void PerfHud::blank(int y, int x) const {
+    for (int row = 0; row < PERF_HUD_LINES; row++) {
+        move(y + row, x);
+        clrtoeol();
+    }
+}
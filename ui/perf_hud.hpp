@@ -0,0 +1,72 @@
+/*
+ * Battleship 1 Game Project
+ * Group: Compmath 2
+ * Author: Poshtak
+ *
+ * File: perf_hud.hpp
+ * Description: Header file for PerfHud, the performance overlay of the game screen
+ *              ('p' toggles it). It shows how long pushing a frame to the terminal
+ *              takes and how many bytes that wrote, the AI's planning time per volley,
+ *              the network round trip and the heap allocations of the last turn.
+ *              While hidden it only keeps the allocation count per turn, so the cost
+ *              of leaving it in the loop is a couple of loads per frame.
+ */
+
+#ifndef PERF_HUD_HPP
+#define PERF_HUD_HPP
+
+#include <cstddef>
+
+struct NetStats;
+
+const int PERF_HUD_LINES = 6;               // Screen rows drawn, title included
+
+class PerfHud {
+public:
+    PerfHud();
+
+    void toggle() { shown = !shown; }
+    bool isShown() const { return shown; }
+
+    // Around each refresh(): time the terminal update and count the bytes it wrote
+    void beginFrame();
+    void endFrame();
+
+    // Account a frame directly (elapsedNs spent, bytes written or -1 if unknown)
+    void recordFrame(long long elapsedNs, long long bytes);
+
+    // Time the AI spent working out its last volley
+    void recordAIDecision(double milliseconds) { aiMs = milliseconds; }
+
+    // Once per loop pass: a new turn number closes the allocation count of the last turn
+    void checkTurn(int turnNumber);
+
+    // Text of HUD row 0..PERF_HUD_LINES-1; net: link statistics, or nullptr (local games)
+    // Returns the number of characters written
+    int formatLine(int row, const NetStats* net, char* buffer, size_t bufferSize) const;
+
+    // Draw the rows from (y, x) to the end of each line
+    void draw(int y, int x, const NetStats* net) const;
+
+    // Blank the rows again after the HUD was hidden
+    void blank(int y, int x) const;
+
+    double getFrameMs() const { return frameMs; }
+    long long getFrameBytes() const { return frameBytes; }
+    long long getTurnAllocations() const { return turnAllocations; }
+
+private:
+    bool shown;
+    long long frameStartNs;
+    long long frameStartBytes;
+    double frameMs;                         // Last frame
+    double framePeakMs;                     // Slowest frame this turn
+    long long frameBytes;                   // Last frame, -1 if the platform cannot tell
+    long long framePeakBytes;
+    double aiMs;                            // -1 until the AI has planned a volley
+    int turn;
+    unsigned long long turnStartAllocations;
+    long long turnAllocations;              // -1 until a turn has finished
+};
+
+#endif
@@ -25,17 +25,22 @@ int getBoardSize() {
     return BOARD_SIZE;
 }
 
+// Width of one board: row labels plus cells plus right margin
+int getBoardWidth(int boardSize, int cellWidth) {
+    return boardSize * cellWidth + 8;
+}
+
 // Check if terminal dimensions are sufficient for game interface
 bool canFitInterface(int boardSize, int maxY, int maxX) {
-    int minY = boardSize + 20;  // Vertical space needed
-    int minX = 2 * (8 + boardSize * 4) + 5;  // Horizontal space for two boards
+    int minY, minX;
+    getRequiredTerminalSize(boardSize, minY, minX);
     return (maxY >= minY && maxX >= minX);
 }
 
 // Calculate minimum required terminal size for given board
 void getRequiredTerminalSize(int boardSize, int &minY, int &minX) {
-    minY = boardSize + 20;
-    minX = 2 * (8 + boardSize * 4) + 5;
+    minY = boardSize + 20;  // Vertical space needed
+    minX = 2 * getBoardWidth(boardSize, COMPACT_CELL_WIDTH) + 5;  // Two compact boards and separator
 }
 
 // Calculate optimal layout positions for all UI elements
@@ -44,9 +49,13 @@ BoardLayout calculateBoardLayout(int boardSize) {
     int maxY, maxX;
     getmaxyx(stdscr, maxY, maxX);
     
-    // Calculate widths
-    int boardWidth = boardSize * 4 + 8;  // Each cell is 4 chars wide, plus labels
+    // Calculate widths; fall back to compact cells if standard ones do not fit
     int separatorWidth = 5;
+    layout.cellWidth = STANDARD_CELL_WIDTH;
+    if (getBoardWidth(boardSize, STANDARD_CELL_WIDTH) * 2 + separatorWidth > maxX) {
+        layout.cellWidth = COMPACT_CELL_WIDTH;
+    }
+    int boardWidth = getBoardWidth(boardSize, layout.cellWidth);
     int totalWidth = boardWidth * 2 + separatorWidth;
     
     // Center boards horizontally
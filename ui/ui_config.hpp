@@ -21,16 +21,24 @@
 const int MIN_BOARD_SIZE = 10;
 const int MAX_BOARD_SIZE = 26;
 
+// Screen columns per board cell: standard " X |" cells, or compact " X" cells
+// used automatically when the terminal is too narrow for the standard grid
+const int STANDARD_CELL_WIDTH = 4;
+const int COMPACT_CELL_WIDTH = 2;
+
 // Set and get current board size
 void setBoardSize(int size);
 int getBoardSize();
 
-// Check if current terminal can fit the game interface
+// Check if current terminal can fit the game interface (in compact mode if needed)
 bool canFitInterface(int boardSize, int maxY, int maxX);
 
-// Calculate minimum terminal dimensions for given board size
+// Calculate minimum terminal dimensions for given board size (compact mode)
 void getRequiredTerminalSize(int boardSize, int &minY, int &minX);
 
+// Width of one board including row labels, for the given cell width
+int getBoardWidth(int boardSize, int cellWidth);
+
 // Structure to hold calculated positions for UI elements
 struct BoardLayout {
     int startY;          // Starting Y position for boards
@@ -40,9 +48,16 @@ struct BoardLayout {
     int instructionsY;   // Y position for instruction text
     int logStartX;       // X position for game log/messages
     int statusY;         // Y position for status messages
+    int cellWidth;       // Screen columns per cell (STANDARD_CELL_WIDTH or COMPACT_CELL_WIDTH)
+
+    // Screen position of cell (x, y) on the player's (left) or opponent's (right) board
+    int playerCellX(int x) const { return board1StartX + 5 + cellWidth * x; }
+    int enemyCellX(int x) const { return board2StartX + 9 + cellWidth * x; }
+    int cellY(int y) const { return startY + 3 + y; }
 };
 
 // Calculate optimal layout based on board size and terminal dimensions
+// Uses standard cells when both boards fit, compact cells otherwise
 BoardLayout calculateBoardLayout(int boardSize);
 
 // Convert column index to letter (0='A', 1='B', etc.)
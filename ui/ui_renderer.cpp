@@ -11,6 +11,8 @@
 
 #include "ui_renderer.hpp"
 #include "ui_animation.hpp"
+#include "../data/trace.hpp"
+#include <algorithm>
 #include <cstring>
 #include <cstdio>
 #include <signal.h>
@@ -104,6 +106,112 @@ void UIRenderer::drawTitle() {
     refresh();
 }
 
+/**
+ * @brief Prebuilt text of the static board frame (titles, headers, grid, borders).
+ * 
+ * Each line spans both boards and the separator, starting at board1StartX, so the
+ * whole frame is drawn with one mvaddnstr per screen row. Offsets are stored relative
+ * to board1StartX, which lets the same template be reused when the layout is only
+ * moved (e.g. after a terminal resize).
+ */
+struct BoardFrameTemplate {
+    int boardSize;
+    int cellWidth;
+    int separatorOffset;           // layout.separatorX - layout.board1StartX
+    int board2Offset;              // layout.board2StartX - layout.board1StartX
+    std::string leftTitle;
+    std::string rightTitle;
+    std::vector<std::string> lines;
+
+    BoardFrameTemplate() : boardSize(0), cellWidth(0), separatorOffset(0), board2Offset(0) {}
+};
+
+static BoardFrameTemplate frameCache;
+
+/**
+ * @brief Writes a title centered in dashes at the given column of a frame line.
+ */
+static void putCenteredTitle(std::string& line, int column, int width, const char* title) {
+    int titleLen = std::min((int)strlen(title), width);
+    int leftPad = (width - titleLen) / 2;
+    line.replace(column, width, std::string(width, '-'));
+    line.replace(column + leftPad, titleLen, title, titleLen);
+}
+
+/**
+ * @brief Writes the column header or a numbered grid row for one board.
+ * @param row 0 for the header ("|  | A | B |..."), otherwise the 1-based row number.
+ * @param cellWidth 4 for " A |" cells, 2 for compact " A" cells.
+ */
+static void putGridRow(std::string& line, int column, int boardSize, int row, int cellWidth) {
+    char label[16];
+    if (row == 0) {
+        snprintf(label, sizeof(label), "|  |");
+    } else {
+        snprintf(label, sizeof(label), "|%2d|", row);
+    }
+    line.replace(column, 4, label);
+    for (int i = 0; i < boardSize; i++) {
+        char* cell = &line[column + 4 + i * cellWidth];
+        cell[0] = ' ';
+        cell[1] = (row == 0) ? (char)('A' + i) : ' ';
+        if (cellWidth == STANDARD_CELL_WIDTH) {
+            cell[2] = ' ';
+            cell[3] = '|';
+        }
+    }
+}
+
+/**
+ * @brief Builds the frame lines of one board, or of two boards and the separator.
+ * @param rightTitle Title of the right board, or nullptr for the left board only.
+ */
+static void buildFrameLines(std::vector<std::string>& lines, int boardSize, int cellWidth,
+                            int separatorOffset, int board2Offset,
+                            const char* leftTitle, const char* rightTitle) {
+    int boardWidth = getBoardWidth(boardSize, cellWidth);
+    int lineWidth = rightTitle ? board2Offset + boardWidth : boardWidth;
+    lines.assign(boardSize + 4, std::string(lineWidth, ' '));
+
+    for (int r = 0; r < boardSize + 4; r++) {
+        std::string& line = lines[r];
+        if (rightTitle) line.replace(separatorOffset, 5, "~~~~~");
+
+        if (r == 0) {
+            // Titles centered in dashes
+            putCenteredTitle(line, 0, boardWidth, leftTitle);
+            if (rightTitle) putCenteredTitle(line, board2Offset, boardWidth, rightTitle);
+        } else if (r == 1 || r == boardSize + 3) {
+            // Title underlines and bottom borders
+            std::string edge(boardWidth, r == 1 ? '_' : '-');
+            line.replace(0, boardWidth, edge);
+            if (rightTitle) line.replace(board2Offset, boardWidth, edge);
+        } else {
+            // Column header (r == 2) or numbered grid row
+            putGridRow(line, 0, boardSize, r - 2, cellWidth);
+            if (rightTitle) putGridRow(line, board2Offset + 4, boardSize, r - 2, cellWidth);
+        }
+    }
+}
+
+/**
+ * @brief Draws frame lines one screen row each, starting at (startY, startX).
+ */
+static void blitFrameLines(const std::vector<std::string>& lines, int startY, int startX) {
+    for (size_t r = 0; r < lines.size(); r++) {
+        mvaddnstr(startY + (int)r, startX, lines[r].c_str(), (int)lines[r].size());
+    }
+}
+
+/**
+ * @brief Draws the frame of the player's board alone (board setup screens).
+ */
+static void drawSingleBoardFrame(const BoardLayout& layout, int boardSize, const char* title) {
+    std::vector<std::string> lines;
+    buildFrameLines(lines, boardSize, layout.cellWidth, 0, 0, title, nullptr);
+    blitFrameLines(lines, layout.startY, layout.board1StartX);
+}
+
 /**
  * @brief Draws the two game boards side by side with headers and grid structure.
  * @param layout Board layout configuration containing position coordinates.
@@ -116,91 +224,31 @@ void UIRenderer::drawTitle() {
  * - Column labels (A, B, C, ...)
  * - Row numbers (1, 2, 3, ...)
  * - Grid lines and separators
+ * 
+ * The frame is built once per (boardSize, layout, titles) and then blitted one row
+ * at a time, so redraws after setup or a resize cost boardSize + 4 calls.
  */
 void UIRenderer::drawGameBoards(const BoardLayout& layout, int boardSize, const char* leftTitle, const char* rightTitle) {
-    int boardWidth = boardSize * 4 + 8;
-    
-    int leftTitleLen = strlen(leftTitle);
-    int rightTitleLen = strlen(rightTitle);
-    
-    // Calculate padding for centered titles
-    int leftPad = (boardWidth - leftTitleLen) / 2;
-    int rightPad = boardWidth - leftPad - leftTitleLen;
-    int leftPad2 = (boardWidth - rightTitleLen) / 2;
-    int rightPad2 = boardWidth - leftPad2 - rightTitleLen;
-    
-    // Draw left board title with dashes
-    move(layout.startY, layout.board1StartX);
-    for (int i = 0; i < leftPad; i++) printw("-");
-    printw("%s", leftTitle);
-    for (int i = 0; i < rightPad; i++) printw("-");
-    
-    // Draw separator between boards
-    move(layout.startY, layout.separatorX);
-    printw("~~~~~");
-    
-    // Draw right board title with dashes
-    move(layout.startY, layout.board2StartX);
-    for (int i = 0; i < leftPad2; i++) printw("-");
-    printw("%s", rightTitle);
-    for (int i = 0; i < rightPad2; i++) printw("-");
-    printw("\n");
-
-    // Draw underline for titles
-    move(layout.startY + 1, layout.board1StartX);
-    for (int i = 0; i < boardWidth; i++) printw("_");
-    move(layout.startY + 1, layout.separatorX);
-    printw("~~~~~");
-    move(layout.startY + 1, layout.board2StartX);
-    for (int i = 0; i < boardWidth; i++) printw("_");
-    printw("\n");
-
-    // Draw column headers (A, B, C, ...)
-    move(layout.startY + 2, layout.board1StartX);
-    printw("|  | A |");
-    for (int i = 1; i < boardSize; i++) {
-        printw(" %c |", 'A' + i);
-    }
-    
-    move(layout.startY + 2, layout.separatorX);
-    printw("~~~~~");
-    
-    move(layout.startY + 2, layout.board2StartX + 4);
-    printw("|  | A |");
-    for (int i = 1; i < boardSize; i++) {
-        printw(" %c |", 'A' + i);
-    }
-    printw("\n");
-
-    // Draw grid rows with row numbers
-    for (int i = 0; i < boardSize; i++) {
-        // Left board row
-        move(layout.startY + 3 + i, layout.board1StartX);
-        printw("|%2d|", i + 1);
-        for (int j = 0; j < boardSize; j++) {
-            printw("   |");
-        }
-        
-        // Separator
-        move(layout.startY + 3 + i, layout.separatorX);
-        printw("~~~~~");
-        
-        // Right board row
-        move(layout.startY + 3 + i, layout.board2StartX + 4);
-        printw("|%2d|", i + 1);
-        for (int j = 0; j < boardSize; j++) {
-            printw("   |");
-        }
+    int separatorOffset = layout.separatorX - layout.board1StartX;
+    int board2Offset = layout.board2StartX - layout.board1StartX;
+    
+    if (frameCache.boardSize != boardSize ||
+        frameCache.cellWidth != layout.cellWidth ||
+        frameCache.separatorOffset != separatorOffset ||
+        frameCache.board2Offset != board2Offset ||
+        frameCache.leftTitle != leftTitle ||
+        frameCache.rightTitle != rightTitle) {
+        frameCache.boardSize = boardSize;
+        frameCache.cellWidth = layout.cellWidth;
+        frameCache.separatorOffset = separatorOffset;
+        frameCache.board2Offset = board2Offset;
+        frameCache.leftTitle = leftTitle;
+        frameCache.rightTitle = rightTitle;
+        buildFrameLines(frameCache.lines, boardSize, layout.cellWidth, separatorOffset, board2Offset,
+                        leftTitle, rightTitle);
     }
 
-    // Draw bottom borders
-    move(layout.startY + 3 + boardSize, layout.board1StartX);
-    for (int i = 0; i < boardWidth; i++) printw("-");
-    move(layout.startY + 3 + boardSize, layout.separatorX);
-    printw("~~~~~");
-    move(layout.startY + 3 + boardSize, layout.board2StartX);
-    for (int i = 0; i < boardWidth; i++) printw("-");
-    printw("\n");
+    blitFrameLines(frameCache.lines, layout.startY, layout.board1StartX);
 }
 
 /**
@@ -218,35 +266,30 @@ void UIRenderer::drawGameBoards(const BoardLayout& layout, int boardSize, const
  * - 'A'-'Z': Ship segments (green on player board, hidden on enemy board)
  */
 void UIRenderer::drawBoardCell(int screenY, int screenX, char cell, bool isPlayerBoard) {
-    move(screenY, screenX);
-    
+    mvaddch(screenY, screenX, cellGlyph(cell, isPlayerBoard));
+    attron(COLOR_PAIR(1));
+}
+
+/**
+ * @brief Converts a cell state into the character and attributes drawn for it.
+ * @param cell The character representing the cell state.
+ * @param isPlayerBoard Whether ships are revealed.
+ * @return The ncurses character with color attributes, as drawn by drawBoardCell.
+ */
+chtype UIRenderer::cellGlyph(char cell, bool isPlayerBoard) {
     if (cell == 'w' || cell == ' ') {
-        addch(' ');
+        return ' ';
     } else if (cell == 'o') {
-        attron(COLOR_PAIR(3)); // Blue for misses
-        addch('O');
-        attroff(COLOR_PAIR(3));
+        return 'O' | COLOR_PAIR(3);            // Blue for misses
     } else if (cell == 'x') {
-        attron(COLOR_PAIR(4)); // Red for hits
-        addch('X');
-        attroff(COLOR_PAIR(4));
+        return 'X' | COLOR_PAIR(4);            // Red for hits
     } else if (cell == 's') {
-        attron(COLOR_PAIR(4) | A_BOLD); // Bold red for sunk ships
-        addch('S');
-        attroff(COLOR_PAIR(4) | A_BOLD);
+        return 'S' | COLOR_PAIR(4) | A_BOLD;   // Bold red for sunk ships
     } else if (cell >= 'A' && cell <= 'Z') {
-        if (isPlayerBoard) {
-            attron(COLOR_PAIR(2)); // Green for player's ships
-            addch(cell);
-            attroff(COLOR_PAIR(2));
-        } else {
-            addch(' '); // Hide enemy ships
-        }
-    } else {
-        addch(cell);
+        // Green for player's ships, enemy ships stay hidden
+        return isPlayerBoard ? ((chtype)(unsigned char)cell | COLOR_PAIR(2)) : (chtype)' ';
     }
-    
-    attron(COLOR_PAIR(1));
+    return (chtype)(unsigned char)cell;
 }
 
 /**
@@ -256,15 +299,12 @@ void UIRenderer::drawBoardCell(int screenY, int screenX, char cell, bool isPlaye
  * @param isPlayerBoard True for player's board, false for enemy's board.
  */
 void UIRenderer::drawBoardState(const BoardLayout& layout, const BoardData& board, bool isPlayerBoard) {
-    // Calculate the starting X offset for the appropriate board
-    int xOffset = isPlayerBoard ? layout.board1StartX + 5 : layout.board2StartX + 9;
-    
+    TRACE_SCOPE("UIRenderer::drawBoardState");
     // Draw each cell in the board
     for (int i = 0; i < board.boardSize; i++) {
         for (int j = 0; j < board.boardSize; j++) {
-            int screenY = layout.startY + 3 + i;
-            int screenX = xOffset + (4 * j);
-            drawBoardCell(screenY, screenX, board.boardArray[i][j], isPlayerBoard);
+            int screenX = isPlayerBoard ? layout.playerCellX(j) : layout.enemyCellX(j);
+            drawBoardCell(layout.cellY(i), screenX, board.boardArray[i][j], isPlayerBoard);
         }
     }
 }
@@ -272,8 +312,9 @@ void UIRenderer::drawBoardState(const BoardLayout& layout, const BoardData& boar
 /**
  * @brief Displays control instructions in the top-left corner.
  * @param layout Board layout configuration (unused but kept for consistency).
+ * @param aiGame Add the heat map toggle (AI games only).
  */
-void UIRenderer::drawInstructions(const BoardLayout& layout) {
+void UIRenderer::drawInstructions(const BoardLayout& layout, bool aiGame) {
     attron(A_UNDERLINE);
     mvprintw(1, 1, "instructions");
     attroff(A_UNDERLINE);
@@ -283,6 +324,8 @@ void UIRenderer::drawInstructions(const BoardLayout& layout) {
     mvprintw(4, 1, "space/enter - select target");
     mvprintw(5, 1, "f - fire all shots");
     mvprintw(6, 1, "q - quit game");
+    if (aiGame) mvprintw(7, 1, "h - AI heat map");
+    mvprintw(aiGame ? 8 : 7, 1, "p - performance HUD");
 }
 
 /**
@@ -291,8 +334,9 @@ void UIRenderer::drawInstructions(const BoardLayout& layout) {
  * @param x X coordinate where to display stats.
  * @param playerShips Number of player's remaining ships.
  * @param enemyShips Number of enemy's remaining ships.
+ * @param netStatus Network latency/traffic line for multiplayer games, or nullptr.
  */
-void UIRenderer::drawGameStats(int y, int x, int playerShips, int enemyShips) {
+void UIRenderer::drawGameStats(int y, int x, int playerShips, int enemyShips, const char* netStatus) {
     move(y, x);
     clrtoeol();
     attron(COLOR_PAIR(5) | A_BOLD);
@@ -303,6 +347,13 @@ void UIRenderer::drawGameStats(int y, int x, int playerShips, int enemyShips) {
     attron(COLOR_PAIR(6) | A_BOLD);
     printw("ENEMY: %d", enemyShips);
     attroff(A_BOLD);
+    
+    if (netStatus) {
+        move(y + 2, x);
+        clrtoeol();
+        attron(COLOR_PAIR(3));
+        printw("%s", netStatus);
+    }
     attron(COLOR_PAIR(1));
 }
 
@@ -339,11 +390,9 @@ void UIRenderer::clearShotIndicator(int y, int x) {
  * @brief Displays the results of a volley (multiple shots).
  * @param startY Y coordinate where to start drawing the result.
  * @param startX X coordinate where to start drawing the result.
- * @param coords String containing the coordinates of shots fired.
- * @param stats String containing statistics (hits, misses, sinks).
- * @param isPlayer True if this is the player's volley, false for enemy's.
+ * @param volley Shots fired and their totals; formatted on the stack, no heap allocation.
  */
-void UIRenderer::drawVolleyResult(int startY, int startX, const std::string& coords, const std::string& stats, bool isPlayer) {
+void UIRenderer::drawVolleyResult(int startY, int startX, const VolleySummary& volley) {
     // Clear the display area
     for (int i = 0; i < 3; i++) {
         move(startY + i, startX);
@@ -351,7 +400,7 @@ void UIRenderer::drawVolleyResult(int startY, int startX, const std::string& coo
     }
     
     // Draw header with appropriate color
-    if (isPlayer) {
+    if (volley.isPlayer) {
         attron(A_UNDERLINE | COLOR_PAIR(2));
         mvprintw(startY, startX, "Your volley:");
         attroff(A_UNDERLINE | COLOR_PAIR(2));
@@ -362,8 +411,10 @@ void UIRenderer::drawVolleyResult(int startY, int startX, const std::string& coo
     }
     
     // Draw coordinates and statistics
+    char text[VOLLEY_TEXT_SIZE];
+    size_t length = volley.format(text, sizeof(text));
     attron(COLOR_PAIR(1));
-    mvprintw(startY + 1, startX, "%s%s", coords.c_str(), stats.c_str());
+    mvaddnstr(startY + 1, startX, text, (int)length);
 }
 
 /**
@@ -820,6 +871,29 @@ bool UIRenderer::showTerminalSizeWarning(int boardSize) {
     return false;
 }
 
+/**
+ * @brief Shows the terminal size requirement while a game is paused by a resize.
+ * @param boardSize Dimension of the board being played.
+ * 
+ * Unlike showTerminalSizeWarning this does not wait for a key; the game loop
+ * keeps polling and redraws the boards once the terminal is large enough.
+ */
+void UIRenderer::drawResizeNotice(int boardSize) {
+    clear();
+    int maxY, maxX;
+    getmaxyx(stdscr, maxY, maxX);
+    
+    int minY, minX;
+    getRequiredTerminalSize(boardSize, minY, minX);
+    
+    attron(COLOR_PAIR(4));
+    mvprintw(maxY/2 - 1, 2, "Terminal too small: %dx%d", maxX, maxY);
+    attroff(COLOR_PAIR(4));
+    attron(COLOR_PAIR(1));
+    mvprintw(maxY/2 + 1, 2, "Enlarge to %dx%d to continue, q to quit", minX, minY);
+    refresh();
+}
+
 /**
  * @brief Asks the player to confirm their board placement.
  * @return True if player confirms (y/Y), false if they decline (n/N).
@@ -870,8 +944,8 @@ void UIRenderer::highlightShipPlacement(const BoardLayout& layout, int cursorX,
     isValid = true;
     
     // Convert screen coordinates to grid coordinates
-    int gridX = (cursorX - layout.board1StartX - 5) / 4;
-    int gridY = cursorY - layout.startY - 3;
+    int gridX = (cursorX - layout.playerCellX(0)) / layout.cellWidth;
+    int gridY = cursorY - layout.cellY(0);
     
     if (orientation == 0) {
         // Horizontal placement (extends left from cursor)
@@ -881,7 +955,7 @@ void UIRenderer::highlightShipPlacement(const BoardLayout& layout, int cursorX,
             // Check if position is valid (in bounds and on water)
             if (checkX < 0 || checkX >= board.boardSize || board.boardArray[gridY][checkX] != 'w') {
                 // Invalid placement - show in red
-                move(cursorY, cursorX - (4 * i));
+                move(cursorY, cursorX - (layout.cellWidth * i));
                 char c = inch() & A_CHARTEXT;
                 attron(COLOR_PAIR(4));
                 addch(c);
@@ -889,7 +963,7 @@ void UIRenderer::highlightShipPlacement(const BoardLayout& layout, int cursorX,
                 isValid = false;
             } else {
                 // Valid placement - show highlighted
-                move(cursorY, cursorX - (4 * i));
+                move(cursorY, cursorX - (layout.cellWidth * i));
                 attron(A_STANDOUT);
                 addch(symbol);
                 attroff(A_STANDOUT);
@@ -933,49 +1007,12 @@ void UIRenderer::highlightShipPlacement(const BoardLayout& layout, int cursorX,
  */
 void UIRenderer::drawGeneratedBoard(const BoardLayout& layout, const BoardData& board) {
     int size = board.boardSize;
-    int boardWidth = size * 4 + 8;
     
     clear();
-    move(layout.startY, layout.board1StartX);
     
     // Choose title based on board size to fit properly
     const char* title = (size >= 20) ? "You" : (size >= 15) ? "Your" : "Your Board";
-    int titleLen = strlen(title);
-    int leftPad = (boardWidth - titleLen) / 2;
-    int rightPad = boardWidth - leftPad - titleLen;
-    
-    // Draw title with dashes
-    for (int i = 0; i < leftPad; i++) printw("-");
-    printw("%s", title);
-    for (int i = 0; i < rightPad; i++) printw("-");
-    printw("\n");
-    
-    // Draw board border
-    move(layout.startY + 1, layout.board1StartX);
-    for (int i = 0; i < boardWidth; i++) printw("_");
-    printw("\n");
-    
-    // Draw column headers (A, B, C, ...)
-    move(layout.startY + 2, layout.board1StartX);
-    printw("|  | A |");
-    for (int i = 1; i < size; i++) {
-        printw(" %c |", 'A' + i);
-    }
-    printw("\n");
-
-    // Draw grid with row numbers
-    for (int i = 0; i < size; i++) {
-        move(layout.startY + 3 + i, layout.board1StartX);
-        printw("|%2d|", i + 1);
-        for (int j = 0; j < size; j++) {
-            printw("   |");
-        }
-    }
-    
-    // Draw bottom border
-    move(layout.startY + 3 + size, layout.board1StartX);
-    for (int i = 0; i < boardWidth; i++) printw("-");
-    printw("\n");
+    drawSingleBoardFrame(layout, size, title);
     
     // Draw instructions for generated board mode
     attron(A_UNDERLINE);
@@ -992,7 +1029,7 @@ void UIRenderer::drawGeneratedBoard(const BoardLayout& layout, const BoardData&
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
             if (board.boardArray[i][j] != 'w') {
-                move(layout.startY + 3 + i, layout.board1StartX + 5 + (j * 4));
+                move(layout.cellY(i), layout.playerCellX(j));
                 addch(board.boardArray[i][j]);
             }
         }
@@ -1010,54 +1047,12 @@ void UIRenderer::drawGeneratedBoard(const BoardLayout& layout, const BoardData&
  */
 void UIRenderer::drawManualBoard(const BoardLayout& layout, const BoardData& board) {
     int size = board.boardSize;
-    int boardWidth = size * 4 + 8;
     
     clear();
-    move(layout.startY, layout.board1StartX);
     
     // Choose title based on board size
     const char* title = (size >= 20) ? "You" : (size >= 15) ? "Your" : "Your Board";
-    int titleLen = strlen(title);
-    int leftPad = (boardWidth - titleLen) / 2;
-    int rightPad = boardWidth - leftPad - titleLen;
-    
-    // Draw title
-    for (int i = 0; i < leftPad; i++) printw("-");
-    printw("%s", title);
-    for (int i = 0; i < rightPad; i++) printw("-");
-    printw("\n");
-    
-    // Draw board border
-    move(layout.startY + 1, layout.board1StartX);
-    for (int i = 0; i < boardWidth; i++) printw("_");
-    printw("\n");
-    
-    // Draw column headers
-    move(layout.startY + 2, layout.board1StartX);
-    printw("|  |");
-    for (int i = 0; i < size; i++) {
-        printw(" %c |", 'A' + i);
-    }
-    printw("\n");
-    
-    // Draw grid rows with row numbers
-    for (int i = 0; i < size; i++) {
-        move(layout.startY + 3 + i, layout.board1StartX);
-        // Format row number (single digit gets space padding)
-        if (i + 1 < 10) {
-            printw("| %d|", i + 1);
-        } else {
-            printw("|%d|", i + 1);
-        }
-        for (int j = 0; j < size; j++) {
-            printw("   |");
-        }
-    }
-    
-    // Draw bottom border
-    move(layout.startY + 3 + size, layout.board1StartX);
-    for (int i = 0; i < boardWidth; i++) printw("-");
-    printw("\n");
+    drawSingleBoardFrame(layout, size, title);
     
     // Draw manual placement instructions
     attron(A_UNDERLINE);
@@ -1074,7 +1069,7 @@ void UIRenderer::drawManualBoard(const BoardLayout& layout, const BoardData& boa
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
             if (board.boardArray[i][j] != 'w') {
-                move(layout.startY + 3 + i, layout.board1StartX + 5 + (j * 4));
+                move(layout.cellY(i), layout.playerCellX(j));
                 attron(A_BOLD);
                 addch(board.boardArray[i][j]);
                 attroff(A_BOLD);
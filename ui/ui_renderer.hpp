@@ -13,6 +13,7 @@
 
 #include "../data/game_state.hpp"
 #include "../data/board_data.hpp"
+#include "../data/volley_summary.hpp"
 #include "ui_config.hpp"
 #include <string>
 #include <vector>
@@ -51,6 +52,13 @@ public:
      */
     static void drawBoardCell(int screenY, int screenX, char cell, bool isPlayerBoard);
 
+    /**
+     * @brief Returns the colored character drawn for a cell state.
+     * @param cell Character to draw ('w', 's', 'x', 'o', etc.).
+     * @param isPlayerBoard If true, reveals ships; otherwise hides them.
+     */
+    static chtype cellGlyph(char cell, bool isPlayerBoard);
+
     /**
      * @brief Iterates through board data and draws the entire grid.
      */
@@ -58,13 +66,16 @@ public:
     
     /**
      * @brief Displays control instructions/keybindings on the screen.
+     * @param aiGame Also list the AI heat map key.
+     * The performance HUD key is listed last.
      */
-    static void drawInstructions(const BoardLayout& layout);
+    static void drawInstructions(const BoardLayout& layout, bool aiGame = false);
 
     /**
      * @brief Shows current statistics (remaining ships for both sides).
+     * @param netStatus Link summary drawn two lines below, or nullptr (local games).
      */
-    static void drawGameStats(int y, int x, int playerShips, int enemyShips);
+    static void drawGameStats(int y, int x, int playerShips, int enemyShips, const char* netStatus = nullptr);
     
     /**
      * @brief Draws the targeting brackets around the current cursor position.
@@ -79,7 +90,7 @@ public:
     /**
      * @brief Displays text feedback for the last shot (Hit/Miss/Sunk).
      */
-    static void drawVolleyResult(int startY, int startX, const std::string& coords, const std::string& stats, bool isPlayer);
+    static void drawVolleyResult(int startY, int startX, const VolleySummary& volley);
     
     /**
      * @brief Displays a temporary status message at specific coordinates.
@@ -130,6 +141,11 @@ public:
      * Displays a warning if too small.
      */
     static bool showTerminalSizeWarning(int boardSize);
+
+    /**
+     * @brief Non-blocking size notice shown while an in-progress game does not fit.
+     */
+    static void drawResizeNotice(int boardSize);
     
     /**
      * @brief Prompts user to confirm their board setup (Y/N).